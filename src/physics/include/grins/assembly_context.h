@@ -26,6 +26,11 @@
 #ifndef GRINS_ASSEMBLY_CONTEXT_H
 #define GRINS_ASSEMBLY_CONTEXT_H
 
+// C++
+#include <map>
+#include <memory>
+#include <string>
+
 // libMesh
 #include "libmesh/fem_context.h"
 
@@ -39,6 +44,20 @@ namespace GRINS
 
   using GRINSFEMContext = libMesh::FEMContext;
 
+  //! Base class for data that Physics attach to an AssemblyContext
+  /*!
+    Since each thread builds its own AssemblyContext, this is the place
+    to keep objects, e.g. property evaluators and scratch space, that are
+    expensive to build and must not be shared across threads. Physics
+    should attach such data in init_context() and retrieve it during
+    assembly.
+  */
+  class AssemblyContextData
+  {
+  public:
+    virtual ~AssemblyContextData() = default;
+  };
+
   class AssemblyContext : public GRINSFEMContext
   {
   public:
@@ -57,12 +76,40 @@ namespace GRINS
 
     const MultiphysicsSystem & get_multiphysics_system() const;
 
+    //! Query whether data has been attached to this context under key
+    bool has_physics_data( const std::string & key ) const
+    { return _physics_data.find(key) != _physics_data.end(); }
+
+    //! Attach data to this context under key. The context takes ownership.
+    /*! Multiple Physics may share the same data by using the same key. */
+    void set_physics_data( const std::string & key,
+                           std::unique_ptr<AssemblyContextData> data );
+
+    //! Retrieve data previously attached under key
+    /*! This is const because Physics need access to their evaluators and
+        scratch space when handed a const context, e.g. for postprocessing.
+        Such data is not part of the logical state of the context. */
+    template<typename DataType>
+    DataType & get_physics_data( const std::string & key ) const;
+
   protected:
 
     CachedValues _cached_values;
 
+    std::map<std::string,std::unique_ptr<AssemblyContextData> > _physics_data;
+
   };
 
+  template<typename DataType>
+  inline
+  DataType & AssemblyContext::get_physics_data( const std::string & key ) const
+  {
+    auto it = _physics_data.find(key);
+    libmesh_assert( it != _physics_data.end() );
+
+    return libMesh::cast_ref<DataType &>( *(it->second) );
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_ASSEMBLY_CONTEXT_H
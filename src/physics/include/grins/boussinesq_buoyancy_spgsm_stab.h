@@ -52,6 +52,8 @@ namespace GRINS
 
     virtual ~BoussinesqBuoyancySPGSMStabilization() = default;
 
+    virtual void init_context( AssemblyContext& context ) override;
+
     virtual void element_time_derivative( bool compute_jacobian,
                                           AssemblyContext & context ) override;
 
@@ -29,6 +29,9 @@
 #include "grins/elastic_membrane_base.h"
 #include "grins/elasticity_tensor.h"
 
+// C++
+#include <array>
+
 namespace GRINS
 {
   template<typename StressStrainLaw>
@@ -84,6 +87,26 @@ namespace GRINS
 
   private:
 
+    //! Residual and Jacobian contributions from one quadrature point
+    /*! The strain variation of every (dof, displacement component) pair is
+        computed once and stored in dgamma in Voigt form, then contracted with
+        a ManifoldDim*(ManifoldDim+1)/2 square elasticity matrix. x holds the
+        deformed tangent vectors dX/dxi^alpha. Only the first AmbientDim
+        entries of F and K are used. */
+    template<unsigned int ManifoldDim, unsigned int AmbientDim>
+    void membrane_qp_kernel( bool compute_jacobian,
+                             unsigned int qp,
+                             unsigned int n_dofs,
+                             const std::array<const std::vector<std::vector<libMesh::Real> >*,ManifoldDim> & dphi,
+                             const std::array<libMesh::RealGradient,ManifoldDim> & x,
+                             const libMesh::TensorValue<libMesh::Real> & tau,
+                             const ElasticityTensor & C,
+                             libMesh::Real res_factor,
+                             libMesh::Real jac_factor,
+                             const std::array<libMesh::DenseSubVector<libMesh::Number>*,3> & F,
+                             const std::array<std::array<libMesh::DenseSubMatrix<libMesh::Number>*,3>,3> & K,
+                             std::vector<libMesh::Real> & dgamma ) const;
+
     //! Index from registering this quantity for postprocessing. Each component will have it's own index.
     std::vector<unsigned int> _stress_indices;
 
@@ -79,6 +79,17 @@ namespace GRINS
 
   protected:
 
+    //! element_time_derivative with the number of velocity components fixed at compile time
+    template<unsigned int Dim>
+    void element_time_derivative_kernel( bool compute_jacobian,
+                                         AssemblyContext & context );
+
+    //! Jacobian of the diffusion term with respect to a solution-dependent viscosity
+    /*! Nothing to do for laminar viscosity models. Viscosity models that
+        depend on other solution variables, e.g. any SpalartAllmarasViscosity,
+        add the velocity-turbulence coupling blocks. */
+    void viscosity_jacobian( AssemblyContext & context, unsigned int qp, libMesh::Real jac );
+
     PressurePinning _p_pinning;
 
     //! Enable pressure pinning
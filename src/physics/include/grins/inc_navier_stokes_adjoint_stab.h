@@ -51,6 +51,23 @@ namespace GRINS
     virtual void mass_residual( bool compute_jacobian,
                                 AssemblyContext & context ) override;
 
+  protected:
+
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
+    void assemble_element_time_derivative( bool compute_jacobian,
+                                           AssemblyContext& context );
+
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
+    void assemble_element_constraint( bool compute_jacobian,
+                                      AssemblyContext & context );
+
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
+    void assemble_mass_residual( bool compute_jacobian,
+                                 AssemblyContext & context );
+
   };
 
 } // end namespace GRINS
@@ -83,17 +83,20 @@ namespace GRINS
     //! Cache index for density post-processing
     unsigned int _rho_index;
 
-    //! Helper function
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_mass_time_deriv( bool compute_jacobian,
                                    AssemblyContext& context,
                                    const CachedValues & cache );
 
-    //! Helper function
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_momentum_time_deriv( bool compute_jacobian,
                                        AssemblyContext& context,
                                        const CachedValues & cache );
 
-    //! Helper function
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_energy_time_deriv( bool compute_jacobian,
                                      AssemblyContext& context,
                                      const CachedValues & cache );
@@ -102,7 +105,8 @@ namespace GRINS
     void assemble_continuity_mass_residual( bool compute_jacobian,
                                             AssemblyContext & context );
 
-    //! Helper function
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_momentum_mass_residual( bool compute_jacobian,
                                           AssemblyContext & context );
 
@@ -50,21 +50,33 @@ namespace GRINS
 
   protected:
 
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_continuity_time_deriv( bool compute_jacobian,
                                          AssemblyContext& context );
 
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_momentum_time_deriv( bool compute_jacobian,
                                        AssemblyContext& context );
 
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_energy_time_deriv( bool compute_jacobian,
                                      AssemblyContext& context );
 
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_continuity_mass_residual( bool compute_jacobian,
                                             AssemblyContext& context );
 
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_momentum_mass_residual( bool compute_jacobian,
                                           AssemblyContext& context );
 
+    //! Helper function, templated on the number of velocity components
+    template<unsigned int Dim>
     void assemble_energy_mass_residual( bool compute_jacobian,
                                         AssemblyContext& context );
   };
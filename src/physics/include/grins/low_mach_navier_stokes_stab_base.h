@@ -66,6 +66,38 @@ namespace GRINS
 
   protected:
 
+    //! Velocity variable indices, templated on the number of velocity components
+    template<unsigned int Dim>
+    void velocity_vars( unsigned int (&u_vars)[Dim] ) const
+    {
+      u_vars[0] = this->_flow_vars.u();
+      u_vars[1] = this->_flow_vars.v();
+      if (Dim == 3)
+        u_vars[Dim-1] = this->_flow_vars.w();
+    }
+
+    //! Velocity at qp from the current solution
+    template<unsigned int Dim>
+    libMesh::RealGradient interior_velocity( AssemblyContext& context, unsigned int qp ) const
+    {
+      libMesh::RealGradient U( context.interior_value(this->_flow_vars.u(), qp),
+                               context.interior_value(this->_flow_vars.v(), qp) );
+      if (Dim == 3)
+        U(2) = context.interior_value(this->_flow_vars.w(), qp);
+      return U;
+    }
+
+    //! Velocity at qp from the fixed solution
+    template<unsigned int Dim>
+    libMesh::RealGradient fixed_interior_velocity( AssemblyContext& context, unsigned int qp ) const
+    {
+      libMesh::RealGradient U( context.fixed_interior_value(this->_flow_vars.u(), qp),
+                               context.fixed_interior_value(this->_flow_vars.v(), qp) );
+      if (Dim == 3)
+        U(2) = context.fixed_interior_value(this->_flow_vars.w(), qp);
+      return U;
+    }
+
     LowMachNavierStokesStabilizationHelper _stab_helper;
 
   };
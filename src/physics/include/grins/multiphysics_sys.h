@@ -28,6 +28,7 @@
 
 // C++
 #include <string>
+#include <vector>
 
 // GRINS
 #include "grins_config.h"
@@ -35,6 +36,7 @@
 #include "grins/neumann_bc_container.h"
 
 // libMesh
+#include "libmesh/elem.h"
 #include "libmesh/fem_system.h"
 
 // libMesh forward declartions
@@ -191,6 +193,11 @@ namespace GRINS
     const std::vector<std::shared_ptr<NeumannBCContainer> >& get_neumann_bcs() const
     { return _neumann_bcs; }
 
+    //! Rebuild the BoundaryID lookup table used to apply Neumann BCs
+    /*! This is done in init_data(), but must be called again if the
+      containers returned by get_neumann_bcs() are modified afterwards. */
+    void build_neumann_bc_table();
+
   private:
 
     //! Container of pointers to Physics classes requested at runtime.
@@ -220,9 +227,36 @@ namespace GRINS
       std::unique_ptr may still actually be an AutoPtr. */
     std::vector<std::shared_ptr<NeumannBCContainer> > _neumann_bcs;
 
+    //! A Neumann BC function together with the variable it applies to
+    typedef std::pair<NeumannBCAbstract*,const FEVariablesBase*> NeumannBCEntry;
+
+    //! Neumann BCs grouped contiguously by BoundaryID
+    /*! The entries for bc_id are [_neumann_bc_offsets[i], _neumann_bc_offsets[i+1])
+      with i = bc_id - _neumann_bc_min_id. Built once by build_neumann_bc_table()
+      so side assembly does no allocation or shared_ptr copies. */
+    std::vector<NeumannBCEntry> _neumann_bc_entries;
+
+    std::vector<unsigned int> _neumann_bc_offsets;
+
+    BoundaryID _neumann_bc_min_id;
+
     //! Constraint application object
     std::unique_ptr<libMesh::System::Constraint> _constraint;
 
+    //! All Physics, in _physics_list order, for evaluations without an element
+    std::vector<Physics*> _all_physics;
+
+    //! Physics active on each subdomain, indexed by subdomain id
+    /*! Built in init_data() and reinit() so that assembly does not have to
+      walk _physics_list and query each Physics on every element. */
+    std::vector<std::vector<Physics*> > _subdomain_physics;
+
+    //! (Re)build _all_physics and _subdomain_physics from the current mesh
+    void build_subdomain_physics_tables();
+
+    //! The Physics to dispatch to for the given element (or all if elem is NULL)
+    const std::vector<Physics*>& active_physics( const libMesh::Elem* elem ) const;
+
     // Useful typedef to pointer-to-member functions so we can call all
     // residual and caching functions using a single function (_general_residual)
     typedef void (Physics::*ResFuncType) (bool, AssemblyContext &);
@@ -234,16 +268,22 @@ namespace GRINS
                             ResFuncType resfunc,
                             CacheFuncType cachefunc);
 
-    //! Extract the bcs from neumann_bcs that are active on bc_id and return them in active_neumann_bcs
-    void get_active_neumann_bcs( BoundaryID bc_id,
-                                 const std::vector<std::shared_ptr<NeumannBCContainer> >& neumann_bcs,
-                                 std::vector<std::shared_ptr<NeumannBCContainer> >& active_neumann_bcs );
-
     //! Applies the subset of _neumann_bcs that are active on the current element side
     bool apply_neumann_bcs( bool request_jacobian,
                             libMesh::DiffContext& context );
   };
 
+  inline
+  const std::vector<Physics*>& MultiphysicsSystem::active_physics( const libMesh::Elem* elem ) const
+  {
+    if( !elem )
+      return _all_physics;
+
+    libmesh_assert_less( elem->subdomain_id(), _subdomain_physics.size() );
+
+    return _subdomain_physics[elem->subdomain_id()];
+  }
+
   inline
   std::shared_ptr<Physics> MultiphysicsSystem::get_physics( const std::string physics_name ) const
   {
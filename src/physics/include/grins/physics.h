@@ -118,6 +118,9 @@ namespace GRINS
     //! Find if current physics is active on supplied element
     virtual bool enabled_on_elem( const libMesh::Elem* elem );
 
+    //! Find if current physics is active on the supplied subdomain
+    virtual bool enabled_on_subdomain( libMesh::subdomain_id_type subdomain_id ) const;
+
     //! Sets whether this physics is to be solved with a steady solver or not
     /*! Since the member variable is static, only needs to be called on a single
       physics. */
@@ -34,6 +34,8 @@
 #include "grins/antioch_options_naming.h"
 #include "grins/antioch_constant_transport_mixture_builder.h"
 #include "grins/antioch_mixture_averaged_transport_mixture_builder.h"
+#include "grins/tabulated_thermo_evaluator.h"
+#include "grins/isat_chemistry_evaluator.h"
 
 namespace GRINS
 {
@@ -57,6 +59,24 @@ namespace GRINS
                                         const std::string& conductivity_model,
                                         const std::string& diffusivity_model ) const;
 
+    //! Builds DerivedPhysics<Mixture,Evaluator>, with Evaluator wrapped by ISAT if requested
+    template<typename Mixture,typename Evaluator>
+    void build_physics_with_evaluator( const GetPot & input, const std::string & physics_name,
+                                       const std::string & material,
+                                       std::unique_ptr<Mixture> & gas_mixture,
+                                       std::unique_ptr<Physics> & new_physics )
+    {
+      if( ISATChemistryEvaluator<Evaluator>::enabled(input,material) )
+        {
+          ISATChemistryEvaluator<Evaluator>::build_tables(input,material,*gas_mixture);
+
+          new_physics.reset(new DerivedPhysics<Mixture,ISATChemistryEvaluator<Evaluator> >
+                            (physics_name,input,gas_mixture) );
+        }
+      else
+        new_physics.reset(new DerivedPhysics<Mixture,Evaluator>(physics_name,input,gas_mixture) );
+    }
+
   private:
 
     void build_mix_avged_physics( const GetPot & input, const std::string & physics_name,
@@ -152,9 +172,18 @@ namespace GRINS
       std::unique_ptr<AntiochMixtureAveragedTransportMixture<KineticsThermo,Thermo,Viscosity,Conductivity,Diffusivity> >
         gas_mixture = mix_builder.build_mixture<KineticsThermo,Thermo,Viscosity,Conductivity,Diffusivity>(input,material);
 
-      new_physics.reset(new DerivedPhysics<AntiochMixtureAveragedTransportMixture<KineticsThermo,Thermo,Viscosity,Conductivity,Diffusivity>,
-                        AntiochMixtureAveragedTransportEvaluator<KineticsThermo,Thermo,Viscosity,Conductivity,Diffusivity> >
-                        (physics_name,input,gas_mixture) );
+      typedef AntiochMixtureAveragedTransportMixture<KineticsThermo,Thermo,Viscosity,Conductivity,Diffusivity> Mixture;
+      typedef AntiochMixtureAveragedTransportEvaluator<KineticsThermo,Thermo,Viscosity,Conductivity,Diffusivity> Evaluator;
+
+      if( TabulatedThermoEvaluator<Evaluator>::enabled(input,material) )
+        {
+          TabulatedThermoEvaluator<Evaluator>::build_table(input,material,*gas_mixture);
+
+          this->build_physics_with_evaluator<Mixture,TabulatedThermoEvaluator<Evaluator> >
+            (input,physics_name,material,gas_mixture,new_physics);
+        }
+      else
+        this->build_physics_with_evaluator<Mixture,Evaluator>(input,physics_name,material,gas_mixture,new_physics);
     }
 
     template<typename KineticsThermo,typename Thermo,typename Conductivity>
@@ -166,9 +195,18 @@ namespace GRINS
       std::unique_ptr<AntiochConstantTransportMixture<KineticsThermo,Conductivity> >
         gas_mixture = mix_builder.build_mixture<KineticsThermo,Conductivity>(input,material);
 
-      new_physics.reset(new DerivedPhysics<AntiochConstantTransportMixture<KineticsThermo,Conductivity>,
-                        AntiochConstantTransportEvaluator<KineticsThermo,Thermo,Conductivity> >
-                        (physics_name,input,gas_mixture) );
+      typedef AntiochConstantTransportMixture<KineticsThermo,Conductivity> Mixture;
+      typedef AntiochConstantTransportEvaluator<KineticsThermo,Thermo,Conductivity> Evaluator;
+
+      if( TabulatedThermoEvaluator<Evaluator>::enabled(input,material) )
+        {
+          TabulatedThermoEvaluator<Evaluator>::build_table(input,material,*gas_mixture);
+
+          this->build_physics_with_evaluator<Mixture,TabulatedThermoEvaluator<Evaluator> >
+            (input,physics_name,material,gas_mixture,new_physics);
+        }
+      else
+        this->build_physics_with_evaluator<Mixture,Evaluator>(input,physics_name,material,gas_mixture,new_physics);
     }
 #endif // GRINS_HAVE_ANTIOCH
 
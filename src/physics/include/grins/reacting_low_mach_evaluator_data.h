@@ -0,0 +1,526 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_REACTING_LOW_MACH_EVALUATOR_DATA_H
+#define GRINS_REACTING_LOW_MACH_EVALUATOR_DATA_H
+
+// C++
+#include <cmath>
+#include <limits>
+#include <string>
+#include <typeinfo>
+#include <valarray>
+#include <vector>
+
+// GRINS
+#include "grins/assembly_context.h"
+
+// libMesh
+#include "libmesh/vector_value.h"
+#include "libmesh/tensor_value.h"
+
+namespace GRINS
+{
+  //! Per-thread gas Evaluator and species scratch space for reacting low Mach flows
+  /*!
+    Evaluators are expensive to build (kinetics, thermo, and transport scratch)
+    and are not thread safe, so we build one per AssemblyContext and reuse it
+    for every element. The ReactingLowMachNavierStokes Physics and its
+    stabilization classes share the same object through the key() method.
+    The species-sized vectors are scratch space so that the quadrature
+    point loops do not allocate.
+  */
+  template<typename Evaluator>
+  class ReactingLowMachEvaluatorData : public AssemblyContextData
+  {
+  public:
+
+    template<typename Mixture>
+    ReactingLowMachEvaluatorData( Mixture & mixture, unsigned int n_species )
+      : gas_evaluator(mixture),
+        Y(n_species,0.0),
+        Y_dot(n_species,0.0),
+        D(n_species,0.0),
+        omega_dot(n_species,0.0),
+        Rs(n_species,0.0),
+        res_Y(n_species,0.0),
+        res_Y_dot(n_species,0.0),
+        res_grad_Y(n_species),
+        res_hess_Y(n_species),
+        res_D(n_species,0.0),
+        res_omega_dot(n_species,0.0),
+        drho_dT(0.0),
+        dcp_dT(0.0),
+        dmu_dT(0.0),
+        dk_dT(0.0),
+        dD_dT(n_species,0.0),
+        domega_dot_dT(n_species,0.0),
+        cp_s(n_species,0.0),
+        drho_dY(n_species,0.0),
+        dcp_dY(n_species,0.0),
+        dmu_dY(n_species,0.0),
+        dk_dY(n_species,0.0),
+        dD_dY(n_species,std::vector<libMesh::Real>(n_species,0.0)),
+        domega_dot_dY(n_species,std::vector<libMesh::Real>(n_species,0.0)),
+        drho_dp0(0.0),
+        dcp_dp0(0.0),
+        dmu_dp0(0.0),
+        dk_dp0(0.0),
+        dD_dp0(n_species,0.0),
+        domega_dot_dp0(n_species,0.0),
+        fixed_Y_dT(n_species),
+        fixed_Y_dp0(n_species),
+        res_h(n_species,0.0),
+        res_lap_Y(n_species,0.0),
+        tau_s(n_species,0.0),
+        d_tau_s_dT(n_species,0.0),
+        d_tau_s_dp0(n_species,0.0),
+        d_tau_s_dU(n_species),
+        d_tau_s(n_species,0.0),
+        dRs(n_species,0.0),
+        _Y_pert(n_species,0.0),
+        _D_pert(n_species,0.0),
+        _domega_dot_drho(n_species,0.0),
+        _domega_dot_drho_s(n_species,std::vector<libMesh::Real>(n_species,0.0))
+    {}
+
+    virtual ~ReactingLowMachEvaluatorData() = default;
+
+    //! Key under which this data is attached to the AssemblyContext
+    static const std::string & key()
+    {
+      static const std::string data_key =
+        std::string("ReactingLowMachEvaluatorData_")+typeid(Evaluator).name();
+      return data_key;
+    }
+
+    //! Build and attach the data to the context, unless it's already there
+    template<typename Mixture>
+    static void attach( AssemblyContext & context, Mixture & mixture, unsigned int n_species )
+    {
+      if( !context.has_physics_data( key() ) )
+        context.set_physics_data
+          ( key(),
+            std::unique_ptr<AssemblyContextData>
+            ( new ReactingLowMachEvaluatorData<Evaluator>(mixture,n_species) ) );
+    }
+
+    static ReactingLowMachEvaluatorData<Evaluator> & get( const AssemblyContext & context )
+    {
+      return context.get_physics_data<ReactingLowMachEvaluatorData<Evaluator> >( key() );
+    }
+
+    Evaluator gas_evaluator;
+
+    //! Scratch space for element quadrature loops
+    std::vector<libMesh::Real> Y;
+    std::vector<libMesh::Real> Y_dot;
+    std::vector<libMesh::Real> D;
+    std::vector<libMesh::Real> omega_dot;
+    std::vector<libMesh::Real> Rs;
+
+    //! Scratch space for strong residual evaluations
+    /*! These are kept separate from the above since the strong residuals
+        are computed from within the quadrature loops that use those. */
+    std::vector<libMesh::Real> res_Y;
+    std::vector<libMesh::Real> res_Y_dot;
+    std::vector<libMesh::RealGradient> res_grad_Y;
+    std::vector<libMesh::RealTensor> res_hess_Y;
+    std::vector<libMesh::Real> res_D;
+    std::vector<libMesh::Real> res_omega_dot;
+
+    //! Struct-of-arrays state for batched Evaluator calls over an element
+    /*! Per-point quantities hold one entry per quadrature point; species
+        quantities are species-major, e.g. batch_Y[s][qp]. */
+    void resize_batch( unsigned int n_points );
+
+    std::valarray<libMesh::Real> batch_T;
+    std::valarray<libMesh::Real> batch_p0;
+    std::valarray<libMesh::Real> batch_rho;
+    std::valarray<libMesh::Real> batch_cp;
+    std::valarray<libMesh::Real> batch_mu;
+    std::valarray<libMesh::Real> batch_k;
+    std::vector<std::valarray<libMesh::Real> > batch_Y;
+    std::vector<std::valarray<libMesh::Real> > batch_h;
+    std::vector<std::valarray<libMesh::Real> > batch_D;
+    std::vector<std::valarray<libMesh::Real> > batch_omega_dot;
+
+    //! Derivatives of the thermochemical state for Jacobian evaluations
+    /*!
+      Given the (clipped) mass fractions Y at temperature T and thermodynamic
+      pressure p0, along with the properties already evaluated there, fill
+      the derivatives below with respect to T and to each Y_t, holding
+      p0 fixed. The source terms, evaluated at the same state, are left in
+      omega_dot.
+
+      Chemistry derivatives come from the Evaluator. The transport models
+      and cp don't provide derivatives, so those are forward differenced.
+      Derivatives with respect to species whose mass fraction was clipped
+      to zero vanish. Pass clipped_Y = false when Y is the raw solution,
+      as in the stabilization residuals, to differentiate every species.
+    */
+    void compute_thermochemistry_derivs( libMesh::Real T, libMesh::Real p0,
+                                         const std::vector<libMesh::Real> & Y,
+                                         libMesh::Real rho, libMesh::Real cp,
+                                         libMesh::Real mu, libMesh::Real k,
+                                         const std::vector<libMesh::Real> & D_s,
+                                         bool clipped_Y = true );
+
+    //! Forward differenced dcp_dT and dcp_dY only, at unclipped Y
+    /*! dcp_dp0 is also filled if thermo_press is true. */
+    void compute_cp_derivs( libMesh::Real T, libMesh::Real p0,
+                            const std::vector<libMesh::Real> & Y,
+                            libMesh::Real cp, bool thermo_press = false );
+
+    libMesh::Real drho_dT;
+    libMesh::Real dcp_dT;
+    libMesh::Real dmu_dT;
+    libMesh::Real dk_dT;
+    std::vector<libMesh::Real> dD_dT;
+    std::vector<libMesh::Real> domega_dot_dT;
+
+    //! Species heat capacities, i.e. dh_s/dT
+    std::vector<libMesh::Real> cp_s;
+
+    std::vector<libMesh::Real> drho_dY;
+    std::vector<libMesh::Real> dcp_dY;
+    std::vector<libMesh::Real> dmu_dY;
+    std::vector<libMesh::Real> dk_dY;
+
+    //! dD_dY[s][t] = dD_s/dY_t
+    std::vector<std::vector<libMesh::Real> > dD_dY;
+
+    //! domega_dot_dY[s][t] = d(omega_dot_s)/dY_t
+    std::vector<std::vector<libMesh::Real> > domega_dot_dY;
+
+    //! Derivatives of the thermochemical state with respect to the thermodynamic pressure
+    /*!
+      Call after compute_thermochemistry_derivs() at the same state. rho and
+      the source terms are differentiated exactly; cp and the transport
+      properties are forward differenced.
+    */
+    void compute_thermo_press_derivs( libMesh::Real T, libMesh::Real p0,
+                                      const std::vector<libMesh::Real> & Y,
+                                      libMesh::Real rho, libMesh::Real cp,
+                                      libMesh::Real mu, libMesh::Real k,
+                                      const std::vector<libMesh::Real> & D_s );
+
+    libMesh::Real drho_dp0;
+    libMesh::Real dcp_dp0;
+    libMesh::Real dmu_dp0;
+    libMesh::Real dk_dp0;
+    std::vector<libMesh::Real> dD_dp0;
+    std::vector<libMesh::Real> domega_dot_dp0;
+
+    //! Derivatives of rho, cp, and the transport properties with respect to one state variable
+    struct PropertyDerivs
+    {
+      PropertyDerivs( unsigned int n_species )
+        : rho(0.0), cp(0.0), mu(0.0), k(0.0), D(n_species,0.0)
+      {}
+
+      libMesh::Real rho;
+      libMesh::Real cp;
+      libMesh::Real mu;
+      libMesh::Real k;
+      std::vector<libMesh::Real> D;
+    };
+
+    //! Derivatives of the properties at mass fractions that are held fixed
+    /*!
+      For quantities evaluated on the fixed solution mass fractions, e.g.
+      stabilization parameters. Fills fixed_Y_dT, and fixed_Y_dp0 if
+      thermo_press is true. rho is differentiated exactly, the rest are
+      forward differenced.
+    */
+    void compute_fixed_Y_derivs( libMesh::Real T, libMesh::Real p0,
+                                 const std::vector<libMesh::Real> & Y,
+                                 libMesh::Real rho, libMesh::Real cp,
+                                 libMesh::Real mu, libMesh::Real k,
+                                 const std::vector<libMesh::Real> & D_s,
+                                 bool thermo_press );
+
+    PropertyDerivs fixed_Y_dT;
+    PropertyDerivs fixed_Y_dp0;
+
+    //! Species enthalpies and Laplacians of the mass fractions from the strong residuals
+    std::vector<libMesh::Real> res_h;
+    std::vector<libMesh::Real> res_lap_Y;
+
+    //! Scratch space for stabilization Jacobians
+    std::vector<libMesh::Real> tau_s;
+    std::vector<libMesh::Real> d_tau_s_dT;
+    std::vector<libMesh::Real> d_tau_s_dp0;
+    std::vector<libMesh::Gradient> d_tau_s_dU;
+    std::vector<libMesh::Real> d_tau_s;
+    std::vector<libMesh::Real> dRs;
+
+  private:
+
+    ReactingLowMachEvaluatorData();
+
+    //! Evaluate rho, cp, mu, k, and D at a perturbed state
+    void perturbed_properties( libMesh::Real T, libMesh::Real p0,
+                               const std::vector<libMesh::Real> & Y,
+                               libMesh::Real & cp, libMesh::Real & mu,
+                               libMesh::Real & k, std::vector<libMesh::Real> & D_s,
+                               libMesh::Real & rho );
+
+    //! Forward differences of the properties from perturbed_properties()
+    void difference_properties( libMesh::Real delta,
+                                libMesh::Real cp, libMesh::Real mu, libMesh::Real k,
+                                const std::vector<libMesh::Real> & D_s,
+                                libMesh::Real cp_pert, libMesh::Real mu_pert, libMesh::Real k_pert,
+                                PropertyDerivs & derivs ) const;
+
+    std::vector<libMesh::Real> _Y_pert;
+    std::vector<libMesh::Real> _D_pert;
+
+    //! d(omega_dot_s)/d(rho) at fixed T and Y, from compute_thermochemistry_derivs()
+    std::vector<libMesh::Real> _domega_dot_drho;
+
+    std::vector<std::vector<libMesh::Real> > _domega_dot_drho_s;
+
+  };
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::resize_batch( unsigned int n_points )
+  {
+    if( batch_T.size() == n_points )
+      return;
+
+    const std::valarray<libMesh::Real> zero(0.0, n_points);
+
+    batch_T.resize(n_points);
+    batch_p0.resize(n_points);
+    batch_rho.resize(n_points);
+    batch_cp.resize(n_points);
+    batch_mu.resize(n_points);
+    batch_k.resize(n_points);
+    batch_Y.assign(Y.size(), zero);
+    batch_h.assign(Y.size(), zero);
+    batch_D.assign(Y.size(), zero);
+    batch_omega_dot.assign(Y.size(), zero);
+  }
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::perturbed_properties( libMesh::Real T, libMesh::Real p0,
+                                                                      const std::vector<libMesh::Real> & Y,
+                                                                      libMesh::Real & cp, libMesh::Real & mu,
+                                                                      libMesh::Real & k, std::vector<libMesh::Real> & D_s,
+                                                                      libMesh::Real & rho )
+  {
+    rho = p0/(gas_evaluator.R_mix(Y)*T);
+    cp = gas_evaluator.cp(T,p0,Y);
+    gas_evaluator.mu_and_k_and_D( T, rho, cp, Y, mu, k, D_s );
+  }
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::difference_properties( libMesh::Real delta,
+                                                                       libMesh::Real cp, libMesh::Real mu, libMesh::Real k,
+                                                                       const std::vector<libMesh::Real> & D_s,
+                                                                       libMesh::Real cp_pert, libMesh::Real mu_pert, libMesh::Real k_pert,
+                                                                       PropertyDerivs & derivs ) const
+  {
+    derivs.cp = (cp_pert - cp)/delta;
+    derivs.mu = (mu_pert - mu)/delta;
+    derivs.k = (k_pert - k)/delta;
+    for( unsigned int s = 0; s < D_s.size(); s++ )
+      derivs.D[s] = (_D_pert[s] - D_s[s])/delta;
+  }
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::compute_cp_derivs( libMesh::Real T, libMesh::Real p0,
+                                                                   const std::vector<libMesh::Real> & Y,
+                                                                   libMesh::Real cp, bool thermo_press )
+  {
+    const libMesh::Real sqrt_eps = std::sqrt(std::numeric_limits<libMesh::Real>::epsilon());
+
+    const libMesh::Real delta_T = sqrt_eps*T;
+    dcp_dT = (gas_evaluator.cp(T+delta_T,p0,Y) - cp)/delta_T;
+
+    if( thermo_press )
+      {
+        const libMesh::Real delta_p0 = sqrt_eps*p0;
+        dcp_dp0 = (gas_evaluator.cp(T,p0+delta_p0,Y) - cp)/delta_p0;
+      }
+
+    _Y_pert = Y;
+
+    for( unsigned int t = 0; t < Y.size(); t++ )
+      {
+        _Y_pert[t] += sqrt_eps;
+        dcp_dY[t] = (gas_evaluator.cp(T,p0,_Y_pert) - cp)/sqrt_eps;
+        _Y_pert[t] = Y[t];
+      }
+  }
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::compute_thermochemistry_derivs( libMesh::Real T, libMesh::Real p0,
+                                                                                const std::vector<libMesh::Real> & Y,
+                                                                                libMesh::Real rho, libMesh::Real cp,
+                                                                                libMesh::Real mu, libMesh::Real k,
+                                                                                const std::vector<libMesh::Real> & D_s,
+                                                                                bool clipped_Y )
+  {
+    const unsigned int n_species = Y.size();
+
+    const libMesh::Real sqrt_eps = std::sqrt(std::numeric_limits<libMesh::Real>::epsilon());
+
+    // rho = p0/(R_mix*T) with R_mix = sum_s Y_s*R_s
+    const libMesh::Real R_mix = gas_evaluator.R_mix(Y);
+    drho_dT = -rho/T;
+
+    for( unsigned int t = 0; t < n_species; t++ )
+      drho_dY[t] = (!clipped_Y || Y[t] > 0.0) ? -rho*gas_evaluator.R(t)/R_mix : 0.0;
+
+    gas_evaluator.cp_s( T, p0, Y, cp_s );
+
+    // Transport and heat capacity, forward differenced
+    libMesh::Real cp_pert, mu_pert, k_pert, rho_pert;
+
+    const libMesh::Real delta_T = sqrt_eps*T;
+    this->perturbed_properties( T+delta_T, p0, Y, cp_pert, mu_pert, k_pert, _D_pert, rho_pert );
+
+    dcp_dT = (cp_pert - cp)/delta_T;
+    dmu_dT = (mu_pert - mu)/delta_T;
+    dk_dT = (k_pert - k)/delta_T;
+    for( unsigned int s = 0; s < n_species; s++ )
+      dD_dT[s] = (_D_pert[s] - D_s[s])/delta_T;
+
+    _Y_pert = Y;
+
+    for( unsigned int t = 0; t < n_species; t++ )
+      {
+        if( !clipped_Y || Y[t] > 0.0 )
+          {
+            const libMesh::Real delta_Y = sqrt_eps;
+            _Y_pert[t] += delta_Y;
+
+            this->perturbed_properties( T, p0, _Y_pert, cp_pert, mu_pert, k_pert, _D_pert, rho_pert );
+
+            _Y_pert[t] = Y[t];
+
+            dcp_dY[t] = (cp_pert - cp)/delta_Y;
+            dmu_dY[t] = (mu_pert - mu)/delta_Y;
+            dk_dY[t] = (k_pert - k)/delta_Y;
+            for( unsigned int s = 0; s < n_species; s++ )
+              dD_dY[s][t] = (_D_pert[s] - D_s[s])/delta_Y;
+          }
+        else
+          {
+            dcp_dY[t] = 0.0;
+            dmu_dY[t] = 0.0;
+            dk_dY[t] = 0.0;
+            for( unsigned int s = 0; s < n_species; s++ )
+              dD_dY[s][t] = 0.0;
+          }
+      }
+
+    // Chemistry: the Evaluator gives us derivatives at fixed partial
+    // densities, rho_t = rho*Y_t, so we need to chain rule through rho(T,Y)
+    gas_evaluator.omega_dot_and_derivs( T, rho, Y, omega_dot, domega_dot_dT, _domega_dot_drho_s );
+
+    for( unsigned int s = 0; s < n_species; s++ )
+      {
+        libMesh::Real drho_term = 0.0;
+        for( unsigned int t = 0; t < n_species; t++ )
+          drho_term += _domega_dot_drho_s[s][t]*Y[t];
+
+        _domega_dot_drho[s] = drho_term;
+
+        domega_dot_dT[s] += drho_term*drho_dT;
+
+        for( unsigned int t = 0; t < n_species; t++ )
+          domega_dot_dY[s][t] = (!clipped_Y || Y[t] > 0.0) ? rho*_domega_dot_drho_s[s][t] + drho_term*drho_dY[t] : 0.0;
+      }
+  }
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::compute_thermo_press_derivs( libMesh::Real T, libMesh::Real p0,
+                                                                             const std::vector<libMesh::Real> & Y,
+                                                                             libMesh::Real rho, libMesh::Real cp,
+                                                                             libMesh::Real mu, libMesh::Real k,
+                                                                             const std::vector<libMesh::Real> & D_s )
+  {
+    const libMesh::Real sqrt_eps = std::sqrt(std::numeric_limits<libMesh::Real>::epsilon());
+
+    // rho = p0/(R_mix*T)
+    drho_dp0 = rho/p0;
+
+    libMesh::Real cp_pert, mu_pert, k_pert, rho_pert;
+
+    const libMesh::Real delta_p0 = sqrt_eps*p0;
+    this->perturbed_properties( T, p0+delta_p0, Y, cp_pert, mu_pert, k_pert, _D_pert, rho_pert );
+
+    dcp_dp0 = (cp_pert - cp)/delta_p0;
+    dmu_dp0 = (mu_pert - mu)/delta_p0;
+    dk_dp0 = (k_pert - k)/delta_p0;
+    for( unsigned int s = 0; s < D_s.size(); s++ )
+      dD_dp0[s] = (_D_pert[s] - D_s[s])/delta_p0;
+
+    // At fixed T and Y the source terms only see p0 through rho
+    for( unsigned int s = 0; s < D_s.size(); s++ )
+      domega_dot_dp0[s] = _domega_dot_drho[s]*drho_dp0;
+  }
+
+  template<typename Evaluator>
+  inline
+  void ReactingLowMachEvaluatorData<Evaluator>::compute_fixed_Y_derivs( libMesh::Real T, libMesh::Real p0,
+                                                                        const std::vector<libMesh::Real> & Y,
+                                                                        libMesh::Real rho, libMesh::Real cp,
+                                                                        libMesh::Real mu, libMesh::Real k,
+                                                                        const std::vector<libMesh::Real> & D_s,
+                                                                        bool thermo_press )
+  {
+    const libMesh::Real sqrt_eps = std::sqrt(std::numeric_limits<libMesh::Real>::epsilon());
+
+    libMesh::Real cp_pert, mu_pert, k_pert, rho_pert;
+
+    const libMesh::Real delta_T = sqrt_eps*T;
+    this->perturbed_properties( T+delta_T, p0, Y, cp_pert, mu_pert, k_pert, _D_pert, rho_pert );
+
+    fixed_Y_dT.rho = -rho/T;
+    this->difference_properties( delta_T, cp, mu, k, D_s, cp_pert, mu_pert, k_pert, fixed_Y_dT );
+
+    if( thermo_press )
+      {
+        const libMesh::Real delta_p0 = sqrt_eps*p0;
+        this->perturbed_properties( T, p0+delta_p0, Y, cp_pert, mu_pert, k_pert, _D_pert, rho_pert );
+
+        fixed_Y_dp0.rho = rho/p0;
+        this->difference_properties( delta_p0, cp, mu, k, D_s, cp_pert, mu_pert, k_pert, fixed_Y_dp0 );
+      }
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_REACTING_LOW_MACH_EVALUATOR_DATA_H
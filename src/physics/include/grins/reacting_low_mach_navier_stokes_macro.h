@@ -7,6 +7,9 @@
 #include "grins/antioch_constant_transport_mixture.h"
 #include "grins/antioch_constant_transport_evaluator.h"
 
+#include "grins/tabulated_thermo_evaluator.h"
+#include "grins/isat_chemistry_evaluator.h"
+
 namespace GRINSPrivate
 {
   // Need typedefs for these because the commas in the template arguments screw up the C preprocessor
@@ -35,21 +38,32 @@ namespace GRINSPrivate
   INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_CURVEFIT_RAW(class_name,ConstantPrandtlConductivity)
 
 
-#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,curve_fit,conductivity,thermo) \
+// The Evaluator is passed through one of the wrapper macros below, e.g.
+// INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTURE_AND_WRAPPED_EVALUATOR(class_name,GRINS_ISAT_EVALUATOR).
+// The plain Evaluator instantiations use GRINS_UNWRAPPED_EVALUATOR.
+#define GRINS_UNWRAPPED_EVALUATOR(...) __VA_ARGS__
+#define GRINS_TABULATED_THERMO_EVALUATOR(...) GRINS::TabulatedThermoEvaluator<__VA_ARGS__ >
+#define GRINS_ISAT_EVALUATOR(...) GRINS::ISATChemistryEvaluator<__VA_ARGS__ >
+#define GRINS_ISAT_TABULATED_THERMO_EVALUATOR(...) GRINS::ISATChemistryEvaluator<GRINS::TabulatedThermoEvaluator<__VA_ARGS__ > >
+
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,curve_fit,conductivity,thermo) \
   template class GRINS::class_name<GRINS::AntiochConstantTransportMixture<curve_fit,GRINS::conductivity>, \
-                                   GRINS::AntiochConstantTransportEvaluator<curve_fit,thermo,GRINS::conductivity> >
+                                   wrapper(GRINS::AntiochConstantTransportEvaluator<curve_fit,thermo,GRINS::conductivity>) >
 
-#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_CURVEFIT_THERMO_RAW(class_name,conductivity) \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,Antioch::CEACurveFit<libMesh::Real>,conductivity,Antioch::StatMechThermodynamics<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,Antioch::CEACurveFit<libMesh::Real>,conductivity,GRINSPrivate::CEAIdealGasThermo); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,Antioch::NASA7CurveFit<libMesh::Real>,conductivity,Antioch::StatMechThermodynamics<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,Antioch::NASA7CurveFit<libMesh::Real>,conductivity,GRINSPrivate::NASA7IdealGasThermo); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,Antioch::NASA9CurveFit<libMesh::Real>,conductivity,Antioch::StatMechThermodynamics<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_RAW(class_name,Antioch::NASA9CurveFit<libMesh::Real>,conductivity,GRINSPrivate::NASA9IdealGasThermo)
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_CURVEFIT_THERMO_RAW(class_name,wrapper,conductivity) \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,Antioch::CEACurveFit<libMesh::Real>,conductivity,Antioch::StatMechThermodynamics<libMesh::Real>); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,Antioch::CEACurveFit<libMesh::Real>,conductivity,GRINSPrivate::CEAIdealGasThermo); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,Antioch::NASA7CurveFit<libMesh::Real>,conductivity,Antioch::StatMechThermodynamics<libMesh::Real>); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,Antioch::NASA7CurveFit<libMesh::Real>,conductivity,GRINSPrivate::NASA7IdealGasThermo); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,Antioch::NASA9CurveFit<libMesh::Real>,conductivity,Antioch::StatMechThermodynamics<libMesh::Real>); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_RAW(class_name,wrapper,Antioch::NASA9CurveFit<libMesh::Real>,conductivity,GRINSPrivate::NASA9IdealGasThermo)
+
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR(class_name,wrapper) \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_CURVEFIT_THERMO_RAW(class_name,wrapper,ConstantConductivity); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR_CURVEFIT_THERMO_RAW(class_name,wrapper,ConstantPrandtlConductivity)
 
 #define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR(class_name) \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_CURVEFIT_THERMO_RAW(class_name,ConstantConductivity); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_CONSTANT_EVALUATOR_CURVEFIT_THERMO_RAW(class_name,ConstantPrandtlConductivity)
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_CONSTANT_MIXTURE_AND_WRAPPED_CONSTANT_EVALUATOR(class_name,GRINS_UNWRAPPED_EVALUATOR)
 
 
 
@@ -139,89 +153,92 @@ namespace GRINSPrivate
 
 
 
-#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name,curve_fit,thermo,viscosity,conductivity,diffusivity) \
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper,curve_fit,thermo,viscosity,conductivity,diffusivity) \
   template class GRINS::class_name<GRINS::AntiochMixtureAveragedTransportMixture<curve_fit,thermo,viscosity,conductivity,diffusivity>, \
-                                   GRINS::AntiochMixtureAveragedTransportEvaluator<curve_fit,thermo,viscosity,conductivity,diffusivity> >
+                                   wrapper(GRINS::AntiochMixtureAveragedTransportEvaluator<curve_fit,thermo,viscosity,conductivity,diffusivity>) >
 
-#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_CURVEFIT_THERMO_CONDUCTIVITY_CONSTLEWIS_RAW(class_name,viscosity) \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_CURVEFIT_THERMO_CONDUCTIVITY_CONSTLEWIS_RAW(class_name,wrapper,viscosity) \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::CEACurveFit<libMesh::Real>, \
                                                                                    Antioch::StatMechThermodynamics<libMesh::Real>, \
                                                                                    viscosity, \
                                                                                    Antioch::EuckenThermalConductivity<Antioch::StatMechThermodynamics<libMesh::Real> >, \
                                                                                    Antioch::ConstantLewisDiffusivity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::CEACurveFit<libMesh::Real>, \
                                                                                    GRINSPrivate::CEAIdealGasThermo, \
                                                                                    viscosity, \
                                                                                    Antioch::EuckenThermalConductivity<GRINSPrivate::CEAIdealGasThermo>, \
                                                                                    Antioch::ConstantLewisDiffusivity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA7CurveFit<libMesh::Real>, \
                                                                                    Antioch::StatMechThermodynamics<libMesh::Real>, \
                                                                                    viscosity, \
                                                                                    Antioch::EuckenThermalConductivity<Antioch::StatMechThermodynamics<libMesh::Real> >, \
                                                                                    Antioch::ConstantLewisDiffusivity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA7CurveFit<libMesh::Real>, \
                                                                                    GRINSPrivate::NASA7IdealGasThermo, \
                                                                                    viscosity, \
                                                                                    Antioch::EuckenThermalConductivity<GRINSPrivate::NASA7IdealGasThermo>, \
                                                                                    Antioch::ConstantLewisDiffusivity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA9CurveFit<libMesh::Real>, \
                                                                                    Antioch::StatMechThermodynamics<libMesh::Real>, \
                                                                                    viscosity, \
                                                                                    Antioch::EuckenThermalConductivity<Antioch::StatMechThermodynamics<libMesh::Real> >, \
                                                                                    Antioch::ConstantLewisDiffusivity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA9CurveFit<libMesh::Real>, \
                                                                                    GRINSPrivate::NASA9IdealGasThermo, \
                                                                                    viscosity, \
                                                                                    Antioch::EuckenThermalConductivity<GRINSPrivate::NASA9IdealGasThermo>, \
                                                                                    Antioch::ConstantLewisDiffusivity<libMesh::Real>)
 
-#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_KINETICS_THEORY_RAW(class_name) \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_KINETICS_THEORY_RAW(class_name,wrapper) \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::CEACurveFit<libMesh::Real>, \
                                                                                    Antioch::StatMechThermodynamics<libMesh::Real>, \
                                                                                    GRINSPrivate::KineticsViscosity, \
                                                                                    GRINSPrivate::KineticsConductivityStatMech, \
                                                                                    GRINSPrivate::BinaryDiffusion); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::CEACurveFit<libMesh::Real>, \
                                                                                    GRINSPrivate::CEAIdealGasThermo, \
                                                                                    GRINSPrivate::KineticsViscosity, \
                                                                                    GRINSPrivate::KineticsConductivityCEA, \
                                                                                    GRINSPrivate::BinaryDiffusion); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA7CurveFit<libMesh::Real>, \
                                                                                    Antioch::StatMechThermodynamics<libMesh::Real>, \
                                                                                    GRINSPrivate::KineticsViscosity, \
                                                                                    GRINSPrivate::KineticsConductivityStatMech, \
                                                                                    GRINSPrivate::BinaryDiffusion); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA7CurveFit<libMesh::Real>, \
                                                                                    GRINSPrivate::NASA7IdealGasThermo, \
                                                                                    GRINSPrivate::KineticsViscosity, \
                                                                                    GRINSPrivate::KineticsConductivityNASA7, \
                                                                                    GRINSPrivate::BinaryDiffusion); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA9CurveFit<libMesh::Real>, \
                                                                                    Antioch::StatMechThermodynamics<libMesh::Real>, \
                                                                                    GRINSPrivate::KineticsViscosity, \
                                                                                    GRINSPrivate::KineticsConductivityStatMech, \
                                                                                    GRINSPrivate::BinaryDiffusion); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_RAW(class_name, \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_RAW(class_name,wrapper, \
                                                                                    Antioch::NASA9CurveFit<libMesh::Real>, \
                                                                                    GRINSPrivate::NASA9IdealGasThermo, \
                                                                                    GRINSPrivate::KineticsViscosity, \
                                                                                    GRINSPrivate::KineticsConductivityNASA9, \
                                                                                    GRINSPrivate::BinaryDiffusion)
 
+#define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTURE_AND_WRAPPED_EVALUATOR(class_name,wrapper) \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_CURVEFIT_THERMO_CONDUCTIVITY_CONSTLEWIS_RAW(class_name,wrapper,Antioch::SutherlandViscosity<libMesh::Real>); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_CURVEFIT_THERMO_CONDUCTIVITY_CONSTLEWIS_RAW(class_name,wrapper,Antioch::BlottnerViscosity<libMesh::Real>); \
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_WRAPPED_EVALUATOR_KINETICS_THEORY_RAW(class_name,wrapper)
+
 #define INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTURE_AND_EVALUATOR(class_name) \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_CURVEFIT_THERMO_CONDUCTIVITY_CONSTLEWIS_RAW(class_name,Antioch::SutherlandViscosity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_CURVEFIT_THERMO_CONDUCTIVITY_CONSTLEWIS_RAW(class_name,Antioch::BlottnerViscosity<libMesh::Real>); \
-  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTUREAVERAGED_MIXTURE_AND_EVALUATOR_KINETICS_THEORY_RAW(class_name)
+  INSTANTIATE_REACTING_LOW_MACH_SUBCLASS_MIXTURE_AND_WRAPPED_EVALUATOR(class_name,GRINS_UNWRAPPED_EVALUATOR)
 
 #endif // GRINS_REACTING_LOW_MACH_NAVIER_STOKES_MACRO_H
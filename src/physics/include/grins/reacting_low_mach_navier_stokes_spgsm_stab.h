@@ -22,6 +22,9 @@
 //
 //-----------------------------------------------------------------------el-
 
+// C++
+#include <algorithm>
+
 // GRINS
 #include "grins/reacting_low_mach_navier_stokes_stab_base.h"
 
@@ -46,6 +49,45 @@ namespace GRINS
     virtual void mass_residual( bool compute_jacobian,
                                 AssemblyContext & context ) override;
 
+  private:
+
+    //! The factors in the SPGSM terms at a quadrature point, or their derivatives along one solution shape function
+    /*! The species factors live in scratch vectors of the ReactingLowMachEvaluatorData. */
+    struct SPGSMTerms
+    {
+      SPGSMTerms( std::vector<libMesh::Real> & tau_s_in, std::vector<libMesh::Real> & Rs_in )
+        : tau_M(0.0), tau_C(0.0), tau_E(0.0), rho(0.0), cp(0.0), RC(0.0), RE(0.0),
+          U(0.0,0.0,0.0), RM(0.0,0.0,0.0), tau_s(tau_s_in), Rs(Rs_in)
+      {}
+
+      //! Zero the factors that don't depend on the current column
+      void zero_stab_params()
+      {
+        tau_M = tau_C = tau_E = rho = cp = 0.0;
+        U = libMesh::Gradient(0.0,0.0,0.0);
+        std::fill( tau_s.begin(), tau_s.end(), 0.0 );
+      }
+
+      libMesh::Real tau_M, tau_C, tau_E, rho, cp, RC, RE;
+      libMesh::Gradient U, RM;
+      std::vector<libMesh::Real> & tau_s;
+      std::vector<libMesh::Real> & Rs;
+    };
+
+    //! Add the derivatives of the SPGSM terms along column j of variable var
+    /*!
+      pspg_sign is +1 for the steady terms and -1 for the transient ones.
+      d_terms must already carry any time solver scaling beyond jac.
+    */
+    void add_jacobian_column( AssemblyContext & context,
+                              unsigned int qp,
+                              VariableIndex var,
+                              unsigned int j,
+                              const SPGSMTerms & terms,
+                              const SPGSMTerms & d_terms,
+                              libMesh::Real pspg_sign,
+                              libMesh::Real jac ) const;
+
   };
 } // end namespace GRINS
 
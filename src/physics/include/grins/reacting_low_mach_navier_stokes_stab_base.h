@@ -32,6 +32,9 @@
 //! GRINS namespace
 namespace GRINS
 {
+  template<typename Evaluator>
+  class ReactingLowMachEvaluatorData;
+
   //! Adds VMS-based stabilization to LowMachNavierStokes physics class
   template<typename Mixture, typename Evaluator>
   class ReactingLowMachNavierStokesStabilizationBase : public ReactingLowMachNavierStokesBase<Mixture>
@@ -61,8 +64,141 @@ namespace GRINS
                                 libMesh::Real& RE_t,
                                 std::vector<libMesh::Real>& Rs_t );
 
+    //! Quantities at a quadrature point that the derivatives of the steady residuals need
+    /*! The species quantities live in the res_* scratch of the ReactingLowMachEvaluatorData. */
+    struct SteadyResidualState
+    {
+      libMesh::Real r, T, p0, R_mix, rho, cp, M, mu, k, lap_T;
+
+      //! drho/dT at fixed p0 and mass fractions, -p0/(R_mix*T^2)
+      libMesh::Real alpha;
+
+      libMesh::Gradient U, grad_T, grad_rho, mass_term, UdotGradU;
+      libMesh::Gradient grad_U[3];
+
+      //! Divergence of the viscous stress divided by mu
+      libMesh::Gradient div_stress;
+    };
+
+    //! Quantities at a quadrature point that the derivatives of the transient residuals need
+    struct TransientResidualState
+    {
+      libMesh::Real T, T_dot, rho, cp, M, M_dot, R_mix;
+      libMesh::Gradient u_dot;
+    };
+
+    //! Steady residuals, also filling the state and thermochemistry derivatives for the d_res_steady_* methods
+    void compute_res_steady( AssemblyContext& context,
+                             unsigned int qp,
+                             libMesh::Real& RP_s,
+                             libMesh::RealGradient& RM_s,
+                             libMesh::Real& RE_s,
+                             std::vector<libMesh::Real>& Rs_s,
+                             SteadyResidualState & state,
+                             bool compute_derivs );
+
+    //! Transient residuals, also filling the state and heat capacity derivatives for the d_res_transient_* methods
+    void compute_res_transient( AssemblyContext& context,
+                                unsigned int qp,
+                                libMesh::Real& RP_t,
+                                libMesh::RealGradient& RM_t,
+                                libMesh::Real& RE_t,
+                                std::vector<libMesh::Real>& Rs_t,
+                                TransientResidualState & state,
+                                bool compute_derivs );
+
+    //! Derivatives of the steady residuals in the direction of a shape function of velocity component c
+    void d_res_steady_d_velocity( const SteadyResidualState & state,
+                                  const ReactingLowMachEvaluatorData<Evaluator> & gas_data,
+                                  unsigned int c,
+                                  libMesh::Real phi,
+                                  const libMesh::Gradient & dphi,
+                                  const libMesh::Tensor & d2phi,
+                                  libMesh::Real & dRP,
+                                  libMesh::Gradient & dRM,
+                                  libMesh::Real & dRE,
+                                  std::vector<libMesh::Real> & dRs ) const;
+
+    //! Derivatives of the steady residuals in the direction of a temperature shape function
+    void d_res_steady_d_temperature( const SteadyResidualState & state,
+                                     const ReactingLowMachEvaluatorData<Evaluator> & gas_data,
+                                     libMesh::Real phi,
+                                     const libMesh::Gradient & dphi,
+                                     const libMesh::Tensor & d2phi,
+                                     libMesh::Real & dRP,
+                                     libMesh::Gradient & dRM,
+                                     libMesh::Real & dRE,
+                                     std::vector<libMesh::Real> & dRs ) const;
+
+    //! Derivatives of the steady residuals in the direction of a shape function of species t
+    void d_res_steady_d_species( const SteadyResidualState & state,
+                                 const ReactingLowMachEvaluatorData<Evaluator> & gas_data,
+                                 unsigned int t,
+                                 libMesh::Real phi,
+                                 const libMesh::Gradient & dphi,
+                                 const libMesh::Tensor & d2phi,
+                                 libMesh::Real & dRP,
+                                 libMesh::Gradient & dRM,
+                                 libMesh::Real & dRE,
+                                 std::vector<libMesh::Real> & dRs ) const;
+
+    //! Derivatives of the steady residuals with respect to the thermodynamic pressure
+    void d_res_steady_d_thermo_press( const SteadyResidualState & state,
+                                      const ReactingLowMachEvaluatorData<Evaluator> & gas_data,
+                                      libMesh::Real & dRP,
+                                      libMesh::Gradient & dRM,
+                                      libMesh::Real & dRE,
+                                      std::vector<libMesh::Real> & dRs ) const;
+
+    //! Derivatives of the transient residuals in the direction of a temperature shape function
+    /*!
+      value_scale and rate_scale are the solution and solution rate
+      derivatives from the context, so the result is the total derivative.
+    */
+    void d_res_transient_d_temperature( const TransientResidualState & state,
+                                        const ReactingLowMachEvaluatorData<Evaluator> & gas_data,
+                                        libMesh::Real phi,
+                                        libMesh::Real value_scale,
+                                        libMesh::Real rate_scale,
+                                        libMesh::Real & dRP,
+                                        libMesh::Gradient & dRM,
+                                        libMesh::Real & dRE,
+                                        std::vector<libMesh::Real> & dRs ) const;
+
+    //! Derivatives of the transient residuals in the direction of a shape function of species t
+    void d_res_transient_d_species( const TransientResidualState & state,
+                                    const ReactingLowMachEvaluatorData<Evaluator> & gas_data,
+                                    unsigned int t,
+                                    libMesh::Real phi,
+                                    libMesh::Real value_scale,
+                                    libMesh::Real rate_scale,
+                                    libMesh::Real & dRP,
+                                    libMesh::Gradient & dRM,
+                                    libMesh::Real & dRE,
+                                    std::vector<libMesh::Real> & dRs ) const;
+
   protected:
 
+    //! Divergence of the viscous stress over mu, axisymmetric terms included
+    /*! Linear in its arguments, so it also gives derivatives when passed shape function data. */
+    libMesh::Gradient viscous_stress_div( libMesh::Real r,
+                                          const libMesh::Gradient & U,
+                                          const libMesh::Gradient (&grad_U)[3],
+                                          const libMesh::Tensor (&hess_U)[3] ) const;
+
+    //! Laplacian from a Hessian and gradient, axisymmetric term included
+    libMesh::Real laplacian( libMesh::Real r,
+                             const libMesh::Gradient & grad,
+                             const libMesh::Tensor & hess ) const;
+
+    //! Derivative of grad(rho) in the direction of a shape function of species t
+    libMesh::Gradient d_grad_rho_d_species( const SteadyResidualState & state,
+                                            unsigned int t,
+                                            libMesh::Real R_t,
+                                            libMesh::Real phi,
+                                            const libMesh::Gradient & dphi ) const;
+
+
     ReactingLowMachNavierStokesStabilizationHelper _stab_helper;
 
   private:
@@ -49,6 +49,12 @@ namespace GRINS
                                        libMesh::Real D_s,
                                        bool is_steady ) const;
 
+    //! Derivative of a tau from compute_tau() with respect to its material property
+    /*! mat_prop is the unsquared property, e.g. mu, k, or D_s. */
+    libMesh::Real compute_d_tau_d_mat_prop( libMesh::Real tau,
+                                            libMesh::Real mat_prop,
+                                            libMesh::RealTensor& G ) const;
+
   }; // class ReactingLowMachNavierStokesStabilizationHelper
 
   /* ------------- Inline Functions ---------------*/
@@ -73,5 +79,14 @@ namespace GRINS
     return this->compute_tau( c, qp, D_s*D_s, g, G, rho, U, is_steady );
   }
 
+  inline
+  libMesh::Real ReactingLowMachNavierStokesStabilizationHelper::compute_d_tau_d_mat_prop( libMesh::Real tau,
+                                                                                          libMesh::Real mat_prop,
+                                                                                          libMesh::RealTensor& G ) const
+  {
+    // tau = _tau_factor/sqrt(X) with dX/d(mat_prop) = 2*_C*mat_prop*G:G
+    return -tau*tau*tau*this->_C*mat_prop*G.contract(G)/(this->_tau_factor*this->_tau_factor);
+  }
+
 }
 #endif // REACTING_LOW_MACH_NAVIER_STOKES_STAB_HELPER_H
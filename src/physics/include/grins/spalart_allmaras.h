@@ -70,6 +70,12 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context ) override;
 
+    //! Caches the wall distance at element quadrature points, if needed
+    virtual void preassembly( MultiphysicsSystem & system ) override;
+
+    //! Invalidates the cached wall distances after the mesh changes
+    virtual void reinit( MultiphysicsSystem & system ) override;
+
     // Element time derivative
     virtual void element_time_derivative( bool compute_jacobian,
                                           AssemblyContext & context ) override;
@@ -51,6 +51,13 @@ namespace GRINS
     // The vorticity function
     libMesh::Real vorticity(AssemblyContext& context, unsigned int qp) const;
 
+    //! The vorticity magnitude and its derivatives
+    /*! Row a of d_vorticity_d_gradU is the derivative with respect to the
+        gradient of velocity component a. */
+    void vorticity_and_derivs( AssemblyContext& context, unsigned int qp,
+                               libMesh::Real & vorticity_value,
+                               libMesh::Tensor & d_vorticity_d_gradU ) const;
+
   protected:
 
     // The flow variables
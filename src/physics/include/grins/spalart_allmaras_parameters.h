@@ -49,14 +49,34 @@ namespace GRINS
     libMesh::Real source_fn( libMesh::Number nu, libMesh::Real mu,
                              libMesh::Real wall_distance, libMesh::Real vorticity_value, bool infinite_distance) const;
 
+    //! The source function \f$ \tilde{S} \f$ and its derivatives
+    /*! Derivatives are with respect to \f$ \nu \f$ and to the vorticity magnitude \f$ S \f$ */
+    void source_fn_and_derivs( libMesh::Number nu, libMesh::Real mu,
+                               libMesh::Real wall_distance, libMesh::Real vorticity_value,
+                               bool infinite_distance,
+                               libMesh::Real & S_tilde,
+                               libMesh::Real & d_S_tilde_d_nu,
+                               libMesh::Real & d_S_tilde_d_vorticity ) const;
+
     // The destruction function \f$ f_w(\nu) \f$
     libMesh::Real destruction_fn( libMesh::Number nu, libMesh::Real wall_distance,
                                   libMesh::Real S_tilde, bool infinite_distance) const;
 
+    //! The destruction function \f$ f_w \f$ and its partial derivatives
+    /*! Derivatives are with respect to \f$ \nu \f$ and \f$ \tilde{S} \f$, holding the other fixed */
+    void destruction_fn_and_derivs( libMesh::Number nu, libMesh::Real wall_distance,
+                                    libMesh::Real S_tilde, bool infinite_distance,
+                                    libMesh::Real & fw,
+                                    libMesh::Real & d_fw_d_nu,
+                                    libMesh::Real & d_fw_d_S_tilde ) const;
+
     //! Helper function
     /*! This expression appears in a couple of places so we provide a function for it*/
     libMesh::Real fv1( libMesh::Real chi ) const;
 
+    //! Derivative of fv1 with respect to chi
+    libMesh::Real d_fv1_d_chi( libMesh::Real chi ) const;
+
     libMesh::Real get_kappa() const
     { return _kappa;}
 
@@ -130,6 +150,16 @@ namespace GRINS
     return chi3/(chi3 + cv13);
   }
 
+  inline
+  libMesh::Real SpalartAllmarasParameters::d_fv1_d_chi( libMesh::Real chi ) const
+  {
+    libMesh::Real chi3 = chi*chi*chi;
+    libMesh::Real cv1 = this->get_cv1();
+    libMesh::Real cv13 = cv1*cv1*cv1;
+
+    return 3.0*chi*chi*cv13/((chi3 + cv13)*(chi3 + cv13));
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_SPALART_ALLMARAS_PARAMETERS_H
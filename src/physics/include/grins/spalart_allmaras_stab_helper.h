@@ -101,26 +101,35 @@ namespace GRINS
                                               const libMesh::Real distance_qp,
                                               const bool infinite_distance) const;
 
+    //! Steady strong residual and its derivatives
+    /*! d_res_dnu and d_res_dU are with respect to the current solution
+        values, d_res_dgradU with respect to the current velocity gradients
+        (row a for component a), and d_res_dgradnu and d_res_dhessnu with
+        respect to the fixed solution. */
     void compute_res_spalart_steady_and_derivs( AssemblyContext& context,
                                                 unsigned int qp,
                                                 const libMesh::Real rho,
                                                 const libMesh::Real mu,
-                                                libMesh::Gradient &res_M,
-                                                libMesh::Tensor &d_res_M_dgradp,
-                                                libMesh::Tensor &d_res_M_dU,
-                                                libMesh::Gradient &d_res_Muvw_dgraduvw,
-                                                libMesh::Tensor &d_res_Muvw_dhessuvw
+                                                const libMesh::Real distance_qp,
+                                                const bool infinite_distance,
+                                                libMesh::Real &res,
+                                                libMesh::Real &d_res_dnu,
+                                                libMesh::Gradient &d_res_dgradnu,
+                                                libMesh::Tensor &d_res_dhessnu,
+                                                libMesh::Gradient &d_res_dU,
+                                                libMesh::Tensor &d_res_dgradU
                                                 ) const;
 
     libMesh::Real compute_res_spalart_transient( AssemblyContext& context,
                                                  unsigned int qp,
                                                  const libMesh::Real rho ) const;
 
+    //! Transient strong residual and its derivative with respect to the rate of nu
     void compute_res_spalart_transient_and_derivs( AssemblyContext& context,
                                                    unsigned int qp,
                                                    const libMesh::Real rho,
-                                                   libMesh::RealGradient &res_M,
-                                                   libMesh::Real &d_res_Muvw_duvw
+                                                   libMesh::Real &res,
+                                                   libMesh::Real &d_res_dnudot
                                                    ) const;
 
     // Registers all parameters in this physics and in its property
@@ -0,0 +1,88 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_WALL_DISTANCE_DATA_H
+#define GRINS_WALL_DISTANCE_DATA_H
+
+// C++
+#include <string>
+
+// GRINS
+#include "grins/assembly_context.h"
+#include "grins/distance_function.h"
+
+namespace GRINS
+{
+  //! Access to the cached wall distance at element quadrature points
+  /*!
+    The wall distance field is fixed between mesh changes, so the owning
+    Physics interpolates it to the quadrature points of every local element
+    once (DistanceFunction::cache_qp_distances()) and assembly kernels read
+    it through the context with no FE work. The SpalartAllmaras Physics and
+    its stabilization classes share the same object through key().
+  */
+  class WallDistanceData : public AssemblyContextData
+  {
+  public:
+
+    WallDistanceData( const DistanceFunction & distance_function )
+      : _distance_function(distance_function)
+    {}
+
+    static const std::string & key()
+    {
+      static const std::string data_key("WallDistanceData");
+      return data_key;
+    }
+
+    //! Build and attach the data to the context, unless it's already there
+    static void attach( AssemblyContext & context, const DistanceFunction & distance_function )
+    {
+      if( !context.has_physics_data( key() ) )
+        context.set_physics_data
+          ( key(),
+            std::unique_ptr<AssemblyContextData>( new WallDistanceData(distance_function) ) );
+    }
+
+    static const WallDistanceData & get( const AssemblyContext & context )
+    {
+      return context.get_physics_data<WallDistanceData>( key() );
+    }
+
+    //! Wall distance at each quadrature point of the context's current element
+    const libMesh::Real * qp_distances( const AssemblyContext & context ) const
+    {
+      return _distance_function.qp_distances( context.get_elem() );
+    }
+
+  private:
+
+    const DistanceFunction & _distance_function;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_WALL_DISTANCE_DATA_H
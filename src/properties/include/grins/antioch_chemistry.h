@@ -40,7 +40,9 @@
 
 // Antioch
 #include "antioch/vector_utils_decl.h"
+#include "antioch/valarray_utils_decl.h"
 #include "antioch/vector_utils.h"
+#include "antioch/valarray_utils.h"
 #include "antioch/chemical_mixture.h"
 
 // libMesh forward declarations
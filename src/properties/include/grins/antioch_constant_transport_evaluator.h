@@ -90,6 +90,26 @@ namespace GRINS
       std::fill( D.begin(), D.end(), _diffusivity.D(rho,cp,k) );
     }
 
+    //! Batched transport properties, species-major D[s][p]
+    void mu_and_k_and_D( const std::valarray<libMesh::Real> & /*T*/,
+                         const std::valarray<libMesh::Real> & rho,
+                         const std::valarray<libMesh::Real> & cp,
+                         const std::vector<std::valarray<libMesh::Real> > & /*Y*/,
+                         std::valarray<libMesh::Real> & mu,
+                         std::valarray<libMesh::Real> & k,
+                         std::vector<std::valarray<libMesh::Real> > & D )
+    {
+      for( std::size_t p = 0; p < rho.size(); p++ )
+        {
+          mu[p] = _mu;
+          k[p] = _conductivity( _mu, cp[p] );
+
+          const libMesh::Real D_p = _diffusivity.D(rho[p],cp[p],k[p]);
+          for( unsigned int s = 0; s < D.size(); s++ )
+            D[s][p] = D_p;
+        }
+    }
+
   protected:
 
     const libMesh::Real _mu;
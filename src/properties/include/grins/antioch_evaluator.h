@@ -30,6 +30,10 @@
 
 #ifdef GRINS_HAVE_ANTIOCH
 
+// C++
+#include <valarray>
+#include <vector>
+
 // GRINS
 #include "grins/antioch_mixture.h"
 #include "grins/antioch_kinetics.h"
@@ -95,11 +99,39 @@ namespace GRINS
     libMesh::Real h_s( const libMesh::Real & T, unsigned int species )
     { return this->specialized_h_s(T,species,*_thermo); }
 
+    // Batched evaluations
+    /*! These take the state at a set of points, e.g. all the quadrature points
+        of an element, as a struct of arrays. Species quantities are
+        species-major: Y[s][p], h[s][p]. */
+    void cp( const std::valarray<libMesh::Real> & T,
+             const std::valarray<libMesh::Real> & P,
+             const std::vector<std::valarray<libMesh::Real> > & Y,
+             std::valarray<libMesh::Real> & cp_mix );
+
+    void h_s( const std::valarray<libMesh::Real> & T,
+              std::vector<std::valarray<libMesh::Real> > & h );
+
     // Kinetics
     void omega_dot( const libMesh::Real& T, libMesh::Real rho,
-                    const std::vector<libMesh::Real> mass_fractions,
+                    const std::vector<libMesh::Real>& mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
+    //! Species mass sources and their derivatives
+    /*! domega_dot_drho_s[s][t] is the derivative of omega_dot[s] with respect to
+        the partial density rho_t = rho*Y_t. Temperature derivatives vanish where
+        T is clipped to the mixture minimum. */
+    void omega_dot_and_derivs( const libMesh::Real& T, libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s );
+
+    //! Batched species mass sources, vectorized across the points
+    void omega_dot( const std::valarray<libMesh::Real> & T,
+                    const std::valarray<libMesh::Real> & rho,
+                    const std::vector<std::valarray<libMesh::Real> > & mass_fractions,
+                    std::vector<std::valarray<libMesh::Real> > & omega_dot );
+
   protected:
 
     const AntiochMixture<KineticsThermoCurveFit> & _chem;
@@ -127,6 +159,16 @@ namespace GRINS
       of Antioch::TempCache! */
     void check_and_reset_temp_cache( const libMesh::Real& T );
 
+    //! Clipped temperatures for batched evaluations
+    /*! Must outlive any TempCache built from it. */
+    std::valarray<libMesh::Real> _batch_clipped_T;
+
+    //! Scratch for gathering the mass fractions at one point of a batch
+    std::vector<libMesh::Real> _Y_point;
+
+    //! Gather the mass fractions at point p of a batch into _Y_point
+    void gather_point( const std::vector<std::valarray<libMesh::Real> > & Y, std::size_t p );
+
   private:
 
     // StatMechThermodynamics methods
@@ -274,6 +316,17 @@ namespace GRINS
     return _chem.species_name(species_index);
   }
 
+  template<typename KineticsThermoCurveFit, typename Thermo>
+  inline
+  void AntiochEvaluator<KineticsThermoCurveFit,Thermo>::gather_point( const std::vector<std::valarray<libMesh::Real> > & Y,
+                                                                      std::size_t p )
+  {
+    libmesh_assert_equal_to( Y.size(), _Y_point.size() );
+
+    for( unsigned int s = 0; s < _Y_point.size(); s++ )
+      _Y_point[s] = Y[s][p];
+  }
+
   template<typename KineticsThermoCurveFit, typename Thermo>
   inline
   void AntiochEvaluator<KineticsThermoCurveFit,Thermo>::check_and_reset_temp_cache( const libMesh::Real& T )
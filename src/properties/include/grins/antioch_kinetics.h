@@ -31,6 +31,8 @@
 #ifdef GRINS_HAVE_ANTIOCH
 
 // C++
+#include <memory>
+#include <valarray>
 #include <vector>
 
 // libMesh
@@ -38,7 +40,9 @@
 
 // Antioch
 #include "antioch/vector_utils_decl.h"
+#include "antioch/valarray_utils_decl.h"
 #include "antioch/vector_utils.h"
+#include "antioch/valarray_utils.h"
 #include "antioch/kinetics_evaluator.h"
 #include "antioch/cea_evaluator.h"
 namespace GRINS
@@ -74,14 +78,64 @@ namespace GRINS
                     const std::vector<libMesh::Real>& mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
+    //! Compute species mass sources and their derivatives
+    /*!
+      Derivatives are taken with respect to temperature and to the species
+      partial densities, rho_s = rho*Y_s, each holding the others fixed:
+      domega_dot_dT[s] = d(omega_dot_s)/dT and
+      domega_dot_drho_s[s][t] = d(omega_dot_s)/d(rho_t).
+    */
+    void omega_dot_and_derivs( const Antioch::TempCache<libMesh::Real>& temp_cache,
+                               const libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s );
+
+    //! Batched evaluation of species mass sources over a set of points
+    /*!
+      The state is given as a struct of arrays: temp_cache and rho hold one
+      entry per point while mass_fractions and omega_dot are species-major,
+      i.e. mass_fractions[s][p]. The kinetics are evaluated with valarray
+      states so that the rate evaluations vectorize across the points.
+    */
+    void omega_dot( const Antioch::TempCache<std::valarray<libMesh::Real> >& temp_cache,
+                    const std::valarray<libMesh::Real>& rho,
+                    const std::vector<std::valarray<libMesh::Real> >& mass_fractions,
+                    std::vector<std::valarray<libMesh::Real> >& omega_dot );
+
   protected:
 
+    //! Fill _molar_densities, clipping if needed. Returns false if there is no density.
+    bool compute_molar_densities( const libMesh::Real rho,
+                                  const std::vector<libMesh::Real>& mass_fractions );
+
     const AntiochMixture<KineticsThermoCurveFit> & _antioch_mixture;
 
     Antioch::KineticsEvaluator<libMesh::Real> _antioch_kinetics;
 
     Antioch::NASAEvaluator<libMesh::Real,KineticsThermoCurveFit> _antioch_nasa_thermo;
 
+    //! Scratch space, reused between calls
+    std::vector<libMesh::Real> _h_RT_minus_s_R;
+    std::vector<libMesh::Real> _dh_RT_minus_s_R_dT;
+    std::vector<libMesh::Real> _molar_densities;
+
+    //! Species whose molar density was clipped on the last evaluation
+    std::vector<bool> _clipped;
+
+    //! Kinetics evaluator for batches of points
+    /*! Antioch sizes its internal state from an example state, so this
+        is rebuilt whenever the number of points changes. */
+    std::unique_ptr<Antioch::KineticsEvaluator<libMesh::Real,std::valarray<libMesh::Real> > > _batch_kinetics;
+
+    //! Species-major scratch space for batched evaluations
+    std::vector<std::valarray<libMesh::Real> > _batch_h_RT_minus_s_R;
+    std::vector<std::valarray<libMesh::Real> > _batch_molar_densities;
+
+    //! Points that have some density to evaluate, when clipping
+    std::vector<bool> _batch_have_density;
+
   private:
 
     AntiochKinetics();
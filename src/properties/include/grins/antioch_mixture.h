@@ -33,6 +33,8 @@
 // GRINS
 #include "grins/antioch_chemistry.h"
 #include "grins/property_types.h"
+#include "grins/tabulated_species_thermo.h"
+#include "grins/isat_table.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -103,6 +105,18 @@ namespace GRINS
     // when calculating reaction rates.
     bool clip_negative_rho() const;
 
+    //! Tabulated species thermo shared by all threads, or NULL if none was built
+    const TabulatedSpeciesThermo * thermo_table() const;
+
+    //! Takes ownership of the table; must be called before threads are forked
+    void set_thermo_table( std::unique_ptr<TabulatedSpeciesThermo> & table );
+
+    //! Per-thread ISAT tables of the source terms, or NULL if ISAT is not in use
+    ISATTableStore * isat_tables() const;
+
+    //! Takes ownership of the tables; must be called before threads are forked
+    void set_isat_tables( std::unique_ptr<ISATTableStore> & tables );
+
   protected:
 
     std::unique_ptr<Antioch::ReactionSet<libMesh::Real> > _reaction_set;
@@ -131,6 +145,10 @@ namespace GRINS
     // By default, negative densities are not clipped to zero.
     bool _clip_negative_rho;
 
+    std::unique_ptr<TabulatedSpeciesThermo> _thermo_table;
+
+    std::unique_ptr<ISATTableStore> _isat_tables;
+
   private:
 
     AntiochMixture();
@@ -176,6 +194,37 @@ namespace GRINS
     return _clip_negative_rho;
   }
 
+  template <typename KineticsThermoCurveFit>
+  inline
+  const TabulatedSpeciesThermo * AntiochMixture<KineticsThermoCurveFit>::thermo_table() const
+  {
+    return _thermo_table.get();
+  }
+
+  template <typename KineticsThermoCurveFit>
+  inline
+  void AntiochMixture<KineticsThermoCurveFit>::set_thermo_table( std::unique_ptr<TabulatedSpeciesThermo> & table )
+  {
+    libmesh_assert( table );
+    libmesh_assert_equal_to( table->n_species(), this->n_species() );
+    _thermo_table.reset( table.release() );
+  }
+
+  template <typename KineticsThermoCurveFit>
+  inline
+  ISATTableStore * AntiochMixture<KineticsThermoCurveFit>::isat_tables() const
+  {
+    return _isat_tables.get();
+  }
+
+  template <typename KineticsThermoCurveFit>
+  inline
+  void AntiochMixture<KineticsThermoCurveFit>::set_isat_tables( std::unique_ptr<ISATTableStore> & tables )
+  {
+    libmesh_assert( tables );
+    _isat_tables.reset( tables.release() );
+  }
+
 } // end namespace GRINS
 
 #endif // GRINS_HAVE_ANTIOCH
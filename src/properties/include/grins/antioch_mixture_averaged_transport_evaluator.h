@@ -74,6 +74,14 @@ namespace GRINS
                          libMesh::Real& mu, libMesh::Real& k,
                          std::vector<libMesh::Real>& D );
 
+    //! Batched transport properties, species-major D[s][p]
+    void mu_and_k_and_D( const std::valarray<libMesh::Real>& T,
+                         const std::valarray<libMesh::Real>& rho,
+                         const std::valarray<libMesh::Real>& cp,
+                         const std::vector<std::valarray<libMesh::Real> >& Y,
+                         std::valarray<libMesh::Real>& mu,
+                         std::valarray<libMesh::Real>& k,
+                         std::vector<std::valarray<libMesh::Real> >& D );
 
   protected:
 
@@ -81,6 +89,9 @@ namespace GRINS
 
     const Antioch::MixtureDiffusion<Diffusivity,libMesh::Real>& _diffusivity;
 
+    //! Scratch for scattering batched diffusivities
+    std::vector<libMesh::Real> _D_point;
+
   private:
 
     AntiochMixtureAveragedTransportEvaluator();
@@ -30,6 +30,10 @@
 
 #ifdef GRINS_HAVE_CANTERA
 
+// C++
+#include <valarray>
+#include <vector>
+
 // GRINS
 #include "grins/cantera_mixture.h"
 #include "grins/cantera_thermo.h"
@@ -97,19 +101,70 @@ namespace GRINS
 
     // Kinetics
     void omega_dot( const libMesh::Real& T, libMesh::Real rho,
-                    const std::vector<libMesh::Real> mass_fractions,
+                    const std::vector<libMesh::Real>& mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
+    //! Species mass sources and their derivatives
+    /*! Cantera doesn't expose source term derivatives, so these are
+        computed by forward differences. domega_dot_drho_s[s][t] is the
+        derivative of omega_dot[s] with respect to rho_t = rho*Y_t. */
+    void omega_dot_and_derivs( const libMesh::Real& T, libMesh::Real rho,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s );
+
+    // Batched evaluations
+    /*! Same interface as AntiochEvaluator: struct of arrays over a set of
+        points, species-major species quantities. Cantera has no vectorized
+        evaluation, so these loop over the points. */
+    void cp( const std::valarray<libMesh::Real>& T,
+             const std::valarray<libMesh::Real>& P,
+             const std::vector<std::valarray<libMesh::Real> >& Y,
+             std::valarray<libMesh::Real>& cp_mix );
+
+    void h_s( const std::valarray<libMesh::Real>& T,
+              std::vector<std::valarray<libMesh::Real> >& h );
+
+    void mu_and_k_and_D( const std::valarray<libMesh::Real>& T,
+                         const std::valarray<libMesh::Real>& rho,
+                         const std::valarray<libMesh::Real>& cp,
+                         const std::vector<std::valarray<libMesh::Real> >& Y,
+                         std::valarray<libMesh::Real>& mu,
+                         std::valarray<libMesh::Real>& k,
+                         std::vector<std::valarray<libMesh::Real> >& D );
+
+    void omega_dot( const std::valarray<libMesh::Real>& T,
+                    const std::valarray<libMesh::Real>& rho,
+                    const std::vector<std::valarray<libMesh::Real> >& mass_fractions,
+                    std::vector<std::valarray<libMesh::Real> >& omega_dot );
+
   protected:
 
     CanteraMixture& _chem;
 
+    //! One clone shared by _thermo, _transport, and _kinetics; declared
+    //! before them so it outlives them
+    CanteraMixture::Lease _lease;
+
     CanteraThermodynamics _thermo;
 
     CanteraTransport _transport;
 
     CanteraKinetics _kinetics;
 
+    //! Scratch space for finite differenced source term derivatives
+    std::vector<libMesh::Real> _Y_pert;
+    std::vector<libMesh::Real> _omega_dot_pert;
+
+    //! Scratch space for batched evaluations
+    std::vector<libMesh::Real> _Y_point;
+    std::vector<libMesh::Real> _species_point;
+
+    void gather_point( const std::vector<std::valarray<libMesh::Real> >& Y, std::size_t p );
+
+    void scatter_point( std::size_t p, std::vector<std::valarray<libMesh::Real> >& V ) const;
+
   private:
 
     CanteraEvaluator();
@@ -236,7 +291,7 @@ namespace GRINS
 
   inline
   void CanteraEvaluator::omega_dot( const libMesh::Real& T, libMesh::Real rho,
-                                    const std::vector<libMesh::Real> mass_fractions,
+                                    const std::vector<libMesh::Real>& mass_fractions,
                                     std::vector<libMesh::Real>& omega_dot )
   {
     _kinetics.omega_dot(T,rho,mass_fractions,omega_dot);
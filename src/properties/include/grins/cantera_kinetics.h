@@ -31,11 +31,15 @@
 #ifdef GRINS_HAVE_CANTERA
 
 // C++
+#include <memory>
 #include <vector>
 
 // libMesh
 #include "libmesh/libmesh_common.h"
 
+// GRINS
+#include "grins/cantera_mixture.h"
+
 // libMesh forward declarations
 class GetPot;
 
@@ -49,13 +53,17 @@ namespace GRINS
 {
   // GRINS forward declarations
   class CachedValues;
-  class CanteraMixture;
 
   class CanteraKinetics
   {
   public:
 
+    //! Checks its own clone out of the mixture's pool
     CanteraKinetics( CanteraMixture& mixture );
+
+    //! Uses the clone of lease, which must outlive this object
+    CanteraKinetics( CanteraMixture& mixture, CanteraMixture::Lease& lease );
+
     ~CanteraKinetics(){};
 
     void omega_dot( const libMesh::Real& T, const libMesh::Real rho,
@@ -64,6 +72,10 @@ namespace GRINS
 
   protected:
 
+    //! Only set when constructed without a Lease; declared before the
+    //! references below, which are bound to its clone
+    std::unique_ptr<CanteraMixture::Lease> _own_lease;
+
     Cantera::IdealGasMix& _cantera_gas;
 
   private:
@@ -30,8 +30,9 @@
 
 #ifdef GRINS_HAVE_CANTERA
 
-// libMesh
-#include "libmesh/threads.h"
+// C++
+#include <mutex>
+#include <vector>
 
 // Cantera (with compiler warnings disabled)
 #include "libmesh/ignore_warnings.h"
@@ -44,26 +45,31 @@
 
 // GRINS
 #include "grins/parameter_user.h"
+#include "grins/isat_table.h"
 
 // libMesh forward declarations
 class GetPot;
 
-namespace
-{
-  static libMesh::Threads::spin_mutex cantera_mutex;
-}
-
 namespace GRINS
 {
   //! Wrapper class for storing state for computing thermochemistry and transport properties using Cantera
   /*!
     This class is expected to be constructed *before* threads have been forked and will
-    live during the whole program. Note that this documentation will always
+    live during the whole program. Cantera phase objects carry mutable state, so each
+    evaluator checks a clone of the gas and transport manager out of a pool for its
+    lifetime through a Lease. Clones are built on demand and returned to the pool when the
+    Lease is destroyed, so the pool never holds more clones than there have been concurrent
+    evaluators and is reused across threaded loops. Only the checkout is serialized; property
+    evaluations themselves are lock free. Note that this documentation will always
     be built regardless if Cantera is included in the GRINS build or not. Check configure
     output to confirm that Cantera was included in the build if you wish to use it.
   */
   class CanteraMixture : public ParameterUser
   {
+  protected:
+
+    struct ThreadObjects;
+
   public:
 
     CanteraMixture( const GetPot& input, const std::string& material );
@@ -75,6 +81,33 @@ namespace GRINS
 
     Cantera::Transport& get_transport();
 
+    //! Exclusive use of a pooled gas clone and its transport manager
+    /*! Construct one per evaluator, after threads have been forked. The clone
+        goes back to the mixture's pool when the Lease is destroyed, so the
+        Lease must not outlive the mixture. */
+    class Lease
+    {
+    public:
+
+      Lease( CanteraMixture& mixture );
+
+      ~Lease();
+
+      Cantera::IdealGasMix& gas();
+
+      Cantera::Transport& transport();
+
+    private:
+
+      Lease();
+      Lease( const Lease& );
+      Lease& operator=( const Lease& );
+
+      CanteraMixture& _mixture;
+
+      ThreadObjects* _objects;
+    };
+
     libMesh::Real M( unsigned int species ) const;
 
     libMesh::Real M_mix( const std::vector<libMesh::Real>& mass_fractions ) const;
@@ -96,6 +129,12 @@ namespace GRINS
 
     const CanteraMixture& chemistry() const;
 
+    //! Per-thread ISAT tables of the source terms, or NULL if ISAT is not in use
+    ISATTableStore* isat_tables() const;
+
+    //! Takes ownership of the tables; must be called before threads are forked
+    void set_isat_tables( std::unique_ptr<ISATTableStore>& tables );
+
     //! This is basically dummy, but is needed for template games elsewhere.
     typedef CanteraMixture ChemistryParent;
 
@@ -105,6 +144,36 @@ namespace GRINS
 
     std::unique_ptr<Cantera::Transport> _cantera_transport;
 
+    //! Clone of the Cantera gas and transport manager handed out by a Lease
+    struct ThreadObjects
+    {
+      std::unique_ptr<Cantera::IdealGasMix> gas;
+      std::unique_ptr<Cantera::Transport> transport;
+    };
+
+    //! An idle clone, building a new one if every clone is leased out
+    ThreadObjects* checkout_thread_objects();
+
+    void return_thread_objects( ThreadObjects* objects );
+
+    void build_cantera_objects( std::unique_ptr<Cantera::IdealGasMix>& gas,
+                                std::unique_ptr<Cantera::Transport>& transport ) const;
+
+    std::string _chem_file;
+
+    std::string _mixture;
+
+    std::unique_ptr<ISATTableStore> _isat_tables;
+
+    //! Every clone built so far; only grows when all of them are leased out
+    std::vector<std::unique_ptr<ThreadObjects> > _thread_objects;
+
+    //! Clones not currently leased
+    std::vector<ThreadObjects*> _idle_thread_objects;
+
+    //! Guards the pool only; never held during property evaluation
+    std::mutex _thread_objects_mutex;
+
     std::string parse_mixture( const GetPot& input, const std::string& material );
 
     std::string parse_chem_file( const GetPot& input, const std::string& material );
@@ -134,6 +203,30 @@ namespace GRINS
     return (*_cantera_transport);
   }
 
+  inline
+  CanteraMixture::Lease::Lease( CanteraMixture& mixture )
+    : _mixture(mixture),
+      _objects(mixture.checkout_thread_objects())
+  {}
+
+  inline
+  CanteraMixture::Lease::~Lease()
+  {
+    _mixture.return_thread_objects(_objects);
+  }
+
+  inline
+  Cantera::IdealGasMix& CanteraMixture::Lease::gas()
+  {
+    return *(_objects->gas);
+  }
+
+  inline
+  Cantera::Transport& CanteraMixture::Lease::transport()
+  {
+    return *(_objects->transport);
+  }
+
   inline
   libMesh::Real CanteraMixture::M( unsigned int species ) const
   {
@@ -176,6 +269,19 @@ namespace GRINS
     return _cantera_gas->speciesName( species_index );
   }
 
+  inline
+  ISATTableStore* CanteraMixture::isat_tables() const
+  {
+    return _isat_tables.get();
+  }
+
+  inline
+  void CanteraMixture::set_isat_tables( std::unique_ptr<ISATTableStore>& tables )
+  {
+    libmesh_assert( tables );
+    _isat_tables.reset( tables.release() );
+  }
+
   inline
   const CanteraMixture& CanteraMixture::chemistry() const
   {
@@ -31,11 +31,15 @@
 #ifdef GRINS_HAVE_CANTERA
 
 // C++
+#include <memory>
 #include <vector>
 
 // libMesh
 #include "libmesh/libmesh_common.h"
 
+// GRINS
+#include "grins/cantera_mixture.h"
+
 // libMesh forward declarations
 class GetPot;
 
@@ -48,7 +52,6 @@ namespace Cantera
 namespace GRINS
 {
   // GRINS forward declarations
-  class CanteraMixture;
   class CachedValues;
 
   //! Wrapper class for evaluating thermo properties using Cantera
@@ -62,7 +65,12 @@ namespace GRINS
   {
   public:
 
+    //! Checks its own clone out of the mixture's pool
     CanteraThermodynamics( CanteraMixture& mixture );
+
+    //! Uses the clone of lease, which must outlive this object
+    CanteraThermodynamics( CanteraMixture& mixture, CanteraMixture::Lease& lease );
+
     ~CanteraThermodynamics(){};
 
     libMesh::Real cp( const libMesh::Real& T, const libMesh::Real P, const std::vector<libMesh::Real>& Y );
@@ -77,6 +85,10 @@ namespace GRINS
 
     CanteraMixture& _cantera_mixture;
 
+    //! Only set when constructed without a Lease; declared before the
+    //! references below, which are bound to its clone
+    std::unique_ptr<CanteraMixture::Lease> _own_lease;
+
     Cantera::IdealGasMix& _cantera_gas;
 
   private:
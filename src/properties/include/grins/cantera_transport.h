@@ -31,11 +31,15 @@
 #ifdef GRINS_HAVE_CANTERA
 
 // C++
+#include <memory>
 #include <vector>
 
 // libMesh
 #include "libmesh/libmesh_common.h"
 
+// GRINS
+#include "grins/cantera_mixture.h"
+
 // libMesh forward declarations
 class GetPot;
 
@@ -51,7 +55,6 @@ namespace GRINS
 
   // GRINS forward declarations
   class CachedValues;
-  class CanteraMixture;
 
   //! Wrapper class for evaluating transport properties using Cantera
   /*!
@@ -64,8 +67,12 @@ namespace GRINS
   {
   public:
 
+    //! Checks its own clone out of the mixture's pool
     CanteraTransport( CanteraMixture& mixture );
 
+    //! Uses the clone of lease, which must outlive this object
+    CanteraTransport( CanteraMixture& mixture, CanteraMixture::Lease& lease );
+
     ~CanteraTransport(){};
 
     libMesh::Real mu( const libMesh::Real& T, const libMesh::Real P, const std::vector<libMesh::Real>& Y );
@@ -81,6 +88,10 @@ namespace GRINS
 
   protected:
 
+    //! Only set when constructed without a Lease; declared before the
+    //! references below, which are bound to its clone
+    std::unique_ptr<CanteraMixture::Lease> _own_lease;
+
     Cantera::IdealGasMix& _cantera_gas;
 
     Cantera::Transport& _cantera_transport;
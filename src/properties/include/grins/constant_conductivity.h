@@ -32,6 +32,7 @@
 
 // libMesh
 #include "libmesh/libmesh_common.h"
+#include "libmesh/quadrature.h"
 
 class GetPot;
 
@@ -55,6 +56,9 @@ namespace GRINS
 
     libMesh::Real operator()(AssemblyContext& context, unsigned int qp) const;
 
+    //! Values at every element quadrature point
+    void operator()(AssemblyContext& context, std::vector<libMesh::Real>& values) const;
+
     libMesh::Real operator()( const libMesh::Point& p, const libMesh::Real time );
 
     libMesh::Real operator()( const libMesh::Real T ) const;
@@ -84,6 +88,12 @@ namespace GRINS
     return _k;
   }
 
+  inline
+  void ConstantConductivity::operator()( AssemblyContext& context, std::vector<libMesh::Real>& values ) const
+  {
+    values.assign( context.get_element_qrule().n_points(), _k );
+  }
+
   inline
   libMesh::Real ConstantConductivity::operator()( const libMesh::Point& /*p*/,
                                                   const libMesh::Real /*time*/ )
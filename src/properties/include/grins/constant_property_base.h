@@ -66,6 +66,9 @@ namespace GRINS
     libMesh::Real op_context_impl(AssemblyContext & /*context*/, unsigned int /*qp*/) const
     { return _value; }
 
+    void op_context_elem_impl(AssemblyContext & context, std::vector<libMesh::Real> & values) const
+    { values.assign(context.get_element_qrule().n_points(), _value); }
+
     libMesh::Real op_point_impl(const libMesh::Point & /*p*/, const libMesh::Real /*time*/)
     { return _value; }
   };
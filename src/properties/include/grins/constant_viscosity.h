@@ -33,6 +33,7 @@
 
 // libMesh
 #include "libmesh/libmesh_common.h"
+#include "libmesh/quadrature.h"
 
 #include "libmesh/fem_system.h"
 
@@ -59,6 +60,9 @@ namespace GRINS
 
     libMesh::Real operator()(AssemblyContext& context, unsigned int qp) const;
 
+    //! Values at every element quadrature point
+    void operator()(AssemblyContext& context, std::vector<libMesh::Real>& values) const;
+
     libMesh::Real operator()( const libMesh::Point& p, const libMesh::Real time );
 
     libMesh::Real operator()( const libMesh::Real T ) const;
@@ -86,6 +90,12 @@ namespace GRINS
     return _mu;
   }
 
+  inline
+  void ConstantViscosity::operator()( AssemblyContext& context, std::vector<libMesh::Real>& values ) const
+  {
+    values.assign( context.get_element_qrule().n_points(), _mu );
+  }
+
   inline
   libMesh::Real ConstantViscosity::operator()( const libMesh::Point& /*p*/,
                                                const libMesh::Real /*time*/ )
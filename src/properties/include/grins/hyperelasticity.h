@@ -31,6 +31,9 @@
 // libMesh
 #include "libmesh/libmesh_common.h"
 
+// C++
+#include <string>
+
 // Forward declarations
 class GetPot;
 namespace libMesh
@@ -47,6 +50,8 @@ namespace GRINS
   public:
     Hyperelasticity( const GetPot& input );
 
+    Hyperelasticity( const GetPot& input, const std::string& material );
+
     virtual ~Hyperelasticity() = default;
 
     // So we can make implementation private
@@ -74,6 +79,37 @@ namespace GRINS
                                          const libMesh::TensorValue<libMesh::Real>& G_contra,
                                          const libMesh::TensorValue<libMesh::Real>& G_cov );
 
+    //! Invariants of the deformation, computed from the full 3x3 metric tensors
+    void compute_invariants( const libMesh::TensorValue<libMesh::Real>& g_contra,
+                             const libMesh::TensorValue<libMesh::Real>& g_cov,
+                             const libMesh::TensorValue<libMesh::Real>& G_contra,
+                             const libMesh::TensorValue<libMesh::Real>& G_cov,
+                             libMesh::Real& I1, libMesh::Real& I2, libMesh::Real& I3 ) const;
+
+    //! B^{ij} = dI2/dG_{ij} = I1 g^{ij} - g^{ik} G_{kl} g^{lj}
+    void compute_B( const libMesh::TensorValue<libMesh::Real>& g_contra,
+                    const libMesh::TensorValue<libMesh::Real>& G_cov,
+                    libMesh::Real I1,
+                    libMesh::TensorValue<libMesh::Real>& B ) const;
+
+    //! Stress with the in-plane dimension fixed at compile time
+    template <unsigned int Dim>
+    void stress_kernel( const libMesh::TensorValue<libMesh::Real>& g_contra,
+                        const libMesh::TensorValue<libMesh::Real>& G_contra,
+                        const libMesh::TensorValue<libMesh::Real>& B,
+                        libMesh::Real I3,
+                        libMesh::Real dWdI1, libMesh::Real dWdI2, libMesh::Real dWdI3,
+                        libMesh::TensorValue<libMesh::Real>& stress ) const;
+
+    //! Stress and elasticity tensor with the in-plane dimension fixed at compile time
+    template <unsigned int Dim>
+    void stress_and_elasticity_kernel( const libMesh::TensorValue<libMesh::Real>& g_contra,
+                                       const libMesh::TensorValue<libMesh::Real>& G_contra,
+                                       const libMesh::TensorValue<libMesh::Real>& B,
+                                       libMesh::Real I1, libMesh::Real I2, libMesh::Real I3,
+                                       libMesh::TensorValue<libMesh::Real>& stress,
+                                       ElasticityTensor& C ) const;
+
     StrainEnergy _W;
 
   };
@@ -0,0 +1,234 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_ISAT_CHEMISTRY_EVALUATOR_H
+#define GRINS_ISAT_CHEMISTRY_EVALUATOR_H
+
+// C++
+#include <memory>
+#include <string>
+#include <valarray>
+#include <vector>
+
+// GRINS
+#include "grins/isat_table.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/libmesh_logging.h"
+#include "libmesh/getpot.h"
+
+namespace GRINS
+{
+  //! Evaluator that answers chemical source term queries from an ISAT table
+  /*!
+    Everything but omega_dot and omega_dot_and_derivs is inherited from
+    Evaluator, which may be any Antioch or Cantera evaluator. Queries are
+    keyed on (T, rho*Y_s) and looked up in an ISATTable leased for the
+    lifetime of this object from the ISATTableStore that build_tables()
+    attaches to the mixture before threads are forked. On a miss the source terms and their
+    derivatives are computed by Evaluator and used to grow or add a record.
+
+    Lookups are too cheap to time per query, so the tables count them and
+    the store prints the hit rate when it is destroyed. Only the misses,
+    "direct_evaluation()" and "add_or_grow()", go in the performance log.
+
+    Like Evaluator, this class is expected to be constructed *after* threads
+    have been forked and will only live during the lifetime of the thread.
+  */
+  template<typename Evaluator>
+  class ISATChemistryEvaluator : public Evaluator
+  {
+  public:
+
+    template<typename Mixture>
+    ISATChemistryEvaluator( Mixture & mixture )
+      : Evaluator(mixture),
+        _lease( table_store(mixture) ),
+        _table( _lease.table() ),
+        _rho_s( _table.n_species(), 0.0 ),
+        _domega_dot_dT( _table.n_species(), 0.0 ),
+        _domega_dot_drho_s( _table.n_species(), std::vector<libMesh::Real>(_table.n_species(), 0.0) ),
+        _omega_dot_point( _table.n_species(), 0.0 )
+    {}
+
+    virtual ~ISATChemistryEvaluator() = default;
+
+    //! Returns true if the user asked for ISAT for this material
+    static bool enabled( const GetPot & input, const std::string & material )
+    { return ISATTableStore::enabled(input,material); }
+
+    //! Give the mixture its ISATTableStore
+    template<typename Mixture>
+    static void build_tables( const GetPot & input, const std::string & material, Mixture & mixture )
+    {
+      std::unique_ptr<ISATTableStore> tables( new ISATTableStore(input,material,mixture.n_species()) );
+      mixture.set_isat_tables(tables);
+    }
+
+    void omega_dot( const libMesh::Real & T, libMesh::Real rho,
+                    const std::vector<libMesh::Real> & mass_fractions,
+                    std::vector<libMesh::Real> & omega_dot );
+
+    void omega_dot_and_derivs( const libMesh::Real & T, libMesh::Real rho,
+                               const std::vector<libMesh::Real> & mass_fractions,
+                               std::vector<libMesh::Real> & omega_dot,
+                               std::vector<libMesh::Real> & domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> > & domega_dot_drho_s );
+
+    //! Batched source terms, species-major Y[s][p] and omega_dot[s][p]
+    void omega_dot( const std::valarray<libMesh::Real> & T,
+                    const std::valarray<libMesh::Real> & rho,
+                    const std::vector<std::valarray<libMesh::Real> > & mass_fractions,
+                    std::vector<std::valarray<libMesh::Real> > & omega_dot );
+
+  protected:
+
+    template<typename Mixture>
+    static ISATTableStore & table_store( Mixture & mixture )
+    {
+      if( !mixture.isat_tables() )
+        libmesh_error_msg("ERROR: The ISAT tables must be built before constructing an ISATChemistryEvaluator!");
+
+      return *(mixture.isat_tables());
+    }
+
+    //! Fill _rho_s
+    void partial_densities( libMesh::Real rho, const std::vector<libMesh::Real> & mass_fractions );
+
+    //! Evaluate through Evaluator and update the table
+    void direct_evaluation( const libMesh::Real & T, libMesh::Real rho,
+                            const std::vector<libMesh::Real> & mass_fractions,
+                            std::vector<libMesh::Real> & omega_dot,
+                            std::vector<libMesh::Real> & domega_dot_dT,
+                            std::vector<std::vector<libMesh::Real> > & domega_dot_drho_s );
+
+    //! Declared before _table, which is bound to its table
+    ISATTableStore::Lease _lease;
+
+    ISATTable & _table;
+
+    std::vector<libMesh::Real> _rho_s;
+
+    //! Scratch space for misses from omega_dot()
+    std::vector<libMesh::Real> _domega_dot_dT;
+    std::vector<std::vector<libMesh::Real> > _domega_dot_drho_s;
+
+    //! Scratch space for the batched omega_dot()
+    std::vector<libMesh::Real> _omega_dot_point;
+
+  private:
+
+    ISATChemistryEvaluator();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  template<typename Evaluator>
+  inline
+  void ISATChemistryEvaluator<Evaluator>::partial_densities( libMesh::Real rho,
+                                                             const std::vector<libMesh::Real> & mass_fractions )
+  {
+    libmesh_assert_equal_to( mass_fractions.size(), _rho_s.size() );
+
+    for( unsigned int s = 0; s < _rho_s.size(); s++ )
+      _rho_s[s] = rho*mass_fractions[s];
+  }
+
+  template<typename Evaluator>
+  inline
+  void ISATChemistryEvaluator<Evaluator>::direct_evaluation( const libMesh::Real & T, libMesh::Real rho,
+                                                             const std::vector<libMesh::Real> & mass_fractions,
+                                                             std::vector<libMesh::Real> & omega_dot,
+                                                             std::vector<libMesh::Real> & domega_dot_dT,
+                                                             std::vector<std::vector<libMesh::Real> > & domega_dot_drho_s )
+  {
+    START_LOG("direct_evaluation()","ISATChemistryEvaluator");
+    Evaluator::omega_dot_and_derivs( T, rho, mass_fractions, omega_dot, domega_dot_dT, domega_dot_drho_s );
+    STOP_LOG("direct_evaluation()","ISATChemistryEvaluator");
+
+    START_LOG("add_or_grow()","ISATChemistryEvaluator");
+    _table.add_or_grow( T, _rho_s, omega_dot, domega_dot_dT, domega_dot_drho_s );
+    STOP_LOG("add_or_grow()","ISATChemistryEvaluator");
+  }
+
+  template<typename Evaluator>
+  inline
+  void ISATChemistryEvaluator<Evaluator>::omega_dot( const libMesh::Real & T, libMesh::Real rho,
+                                                     const std::vector<libMesh::Real> & mass_fractions,
+                                                     std::vector<libMesh::Real> & omega_dot )
+  {
+    this->partial_densities( rho, mass_fractions );
+
+    const bool found = _table.retrieve( T, _rho_s, omega_dot, nullptr, nullptr );
+
+    if( !found )
+      this->direct_evaluation( T, rho, mass_fractions, omega_dot, _domega_dot_dT, _domega_dot_drho_s );
+  }
+
+  template<typename Evaluator>
+  inline
+  void ISATChemistryEvaluator<Evaluator>::omega_dot_and_derivs( const libMesh::Real & T, libMesh::Real rho,
+                                                                const std::vector<libMesh::Real> & mass_fractions,
+                                                                std::vector<libMesh::Real> & omega_dot,
+                                                                std::vector<libMesh::Real> & domega_dot_dT,
+                                                                std::vector<std::vector<libMesh::Real> > & domega_dot_drho_s )
+  {
+    this->partial_densities( rho, mass_fractions );
+
+    const bool found = _table.retrieve( T, _rho_s, omega_dot, &domega_dot_dT, &domega_dot_drho_s );
+
+    if( !found )
+      this->direct_evaluation( T, rho, mass_fractions, omega_dot, domega_dot_dT, domega_dot_drho_s );
+  }
+
+  template<typename Evaluator>
+  inline
+  void ISATChemistryEvaluator<Evaluator>::omega_dot( const std::valarray<libMesh::Real> & T,
+                                                     const std::valarray<libMesh::Real> & rho,
+                                                     const std::vector<std::valarray<libMesh::Real> > & mass_fractions,
+                                                     std::vector<std::valarray<libMesh::Real> > & omega_dot )
+  {
+    const unsigned int n_species = _table.n_species();
+
+    libmesh_assert_equal_to( mass_fractions.size(), n_species );
+    libmesh_assert_equal_to( omega_dot.size(), n_species );
+    libmesh_assert_equal_to( T.size(), rho.size() );
+
+    for( std::size_t p = 0; p < T.size(); p++ )
+      {
+        this->gather_point( mass_fractions, p );
+
+        this->omega_dot( T[p], rho[p], this->_Y_point, _omega_dot_point );
+
+        for( unsigned int s = 0; s < n_species; s++ )
+          omega_dot[s][p] = _omega_dot_point[s];
+      }
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_ISAT_CHEMISTRY_EVALUATOR_H
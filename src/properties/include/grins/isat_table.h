@@ -0,0 +1,275 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+
+#ifndef GRINS_ISAT_TABLE_H
+#define GRINS_ISAT_TABLE_H
+
+// C++
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/getpot.h"
+
+namespace GRINS
+{
+  //! In-situ adaptive table of chemical source terms for a single thread
+  /*!
+    Each record stores the source terms omega_dot and their sensitivities at
+    a composition point x = (T, rho_1, ..., rho_n), where rho_s = rho*Y_s are
+    the partial densities, together with an ellipsoid of accuracy (EOA)
+    { x : (x-x0)^T M (x-x0) <= 1 }. Queries inside an EOA are answered by the
+    linear approximation omega_dot(x0) + A (x-x0), A being the stored
+    sensitivities, which are also returned as the Jacobian.
+
+    When no record covers a query, the caller evaluates the source terms
+    directly and hands them to add_or_grow(). If the linear approximation of
+    the closest record is still within tolerance at the new point, that EOA
+    is grown to include it (the minimal rank-one update that keeps the
+    center fixed); otherwise a new record is added. Records are kept in most
+    recently used order, only the first max_search are searched, and the
+    least recently used is evicted once the table holds max_records.
+
+    The tolerance is on the 2-norm of the error in omega_dot, relative to
+    max(|omega_dot|,omega_floor). New EOAs are balls with radius radius_T in
+    temperature and radius_rho in each partial density.
+
+    A table is not thread safe; see ISATTableStore.
+  */
+  class ISATTable
+  {
+  public:
+
+    ISATTable( unsigned int n_species,
+               libMesh::Real tolerance,
+               libMesh::Real omega_floor,
+               libMesh::Real radius_T,
+               libMesh::Real radius_rho,
+               unsigned int max_records,
+               unsigned int max_search );
+
+    ~ISATTable() = default;
+
+    //! Approximate the source terms at (T,rho_s) from a stored record
+    /*! Returns false if none of the searched records cover the query point.
+        The derivatives are only filled if the pointers are not NULL;
+        domega_dot_drho_s[s][t] is the derivative of omega_dot[s] with
+        respect to rho_t. */
+    bool retrieve( libMesh::Real T,
+                   const std::vector<libMesh::Real> & rho_s,
+                   std::vector<libMesh::Real> & omega_dot,
+                   std::vector<libMesh::Real> * domega_dot_dT,
+                   std::vector<std::vector<libMesh::Real> > * domega_dot_drho_s );
+
+    //! Incorporate a direct evaluation at the point of the last failed retrieve()
+    void add_or_grow( libMesh::Real T,
+                      const std::vector<libMesh::Real> & rho_s,
+                      const std::vector<libMesh::Real> & omega_dot,
+                      const std::vector<libMesh::Real> & domega_dot_dT,
+                      const std::vector<std::vector<libMesh::Real> > & domega_dot_drho_s );
+
+    unsigned int n_species() const
+    { return _n_species; }
+
+    std::size_t size() const
+    { return _records.size(); }
+
+    unsigned long n_queries() const
+    { return _n_queries; }
+
+    unsigned long n_retrieves() const
+    { return _n_retrieves; }
+
+    unsigned long n_grows() const
+    { return _n_grows; }
+
+    unsigned long n_adds() const
+    { return _n_adds; }
+
+    unsigned long n_evictions() const
+    { return _n_evictions; }
+
+  protected:
+
+    struct Record
+    {
+      //! (T, rho_1, ..., rho_n)
+      std::vector<libMesh::Real> x;
+
+      std::vector<libMesh::Real> omega_dot;
+
+      //! A[s*(n+1)+j] = d omega_dot[s] / d x[j]
+      std::vector<libMesh::Real> A;
+
+      //! EOA matrix, (n+1)x(n+1) row major
+      std::vector<libMesh::Real> M;
+    };
+
+    typedef std::list<Record>::iterator RecordIterator;
+
+    //! Fill _dx with the query point minus the record point, return (dx)^T M (dx)
+    libMesh::Real eoa_distance( const Record & record,
+                                libMesh::Real T,
+                                const std::vector<libMesh::Real> & rho_s );
+
+    //! Evaluate omega_dot(x0) + A dx for the last _dx
+    void linear_approximation( const Record & record, std::vector<libMesh::Real> & omega_dot ) const;
+
+    void grow( Record & record, libMesh::Real gamma2 );
+
+    void add( libMesh::Real T,
+              const std::vector<libMesh::Real> & rho_s,
+              const std::vector<libMesh::Real> & omega_dot,
+              const std::vector<libMesh::Real> & domega_dot_dT,
+              const std::vector<std::vector<libMesh::Real> > & domega_dot_drho_s );
+
+    const unsigned int _n_species;
+
+    const libMesh::Real _tolerance;
+
+    const libMesh::Real _omega_floor;
+
+    const libMesh::Real _radius_T;
+
+    const libMesh::Real _radius_rho;
+
+    const unsigned int _max_records;
+
+    const unsigned int _max_search;
+
+    //! Most recently used first
+    std::list<Record> _records;
+
+    //! Closest record found by the last failed retrieve(), if any
+    RecordIterator _closest;
+
+    libMesh::Real _closest_gamma2;
+
+    //! Scratch space
+    std::vector<libMesh::Real> _dx, _Mdx, _omega_lin;
+
+    unsigned long _n_queries, _n_retrieves, _n_grows, _n_adds, _n_evictions;
+
+  private:
+
+    ISATTable();
+
+  };
+
+  //! Pool of the ISAT tables of one mixture
+  /*!
+    Owned by the mixture, so the tables persist across assemblies. Each
+    evaluator checks a table out through a Lease for its lifetime and returns
+    it, records included, when the Lease is destroyed. The next evaluator,
+    on whatever thread, picks the table back up, so the hit rate survives
+    threads that only live for one loop, and the pool never holds more
+    tables than there have been concurrent evaluators; memory is bounded by
+    that number times max_records. Only checkout and return are serialized.
+    The options are read from
+    Materials/<material>/GasMixture/ISAT: tolerance, omega_floor, radius_T,
+    radius_rho, max_records, and max_search.
+  */
+  class ISATTableStore
+  {
+  public:
+
+    ISATTableStore( const GetPot & input, const std::string & material, unsigned int n_species );
+
+    //! Prints the statistics if any queries were made
+    ~ISATTableStore();
+
+    //! Returns true if the user asked for ISAT for this material
+    static bool enabled( const GetPot & input, const std::string & material )
+    { return input( "Materials/"+material+"/GasMixture/ISAT/enabled", false ); }
+
+    //! Exclusive use of one table of the store
+    /*! Must not outlive the store. */
+    class Lease
+    {
+    public:
+
+      Lease( ISATTableStore & store );
+
+      ~Lease();
+
+      ISATTable & table()
+      { return *_table; }
+
+    private:
+
+      Lease();
+      Lease( const Lease & );
+      Lease & operator=( const Lease & );
+
+      ISATTableStore & _store;
+
+      ISATTable * _table;
+    };
+
+    //! Number of tables built so far
+    std::size_t n_tables();
+
+    //! Query, retrieve, grow, add, and eviction counts summed over tables
+    void print_statistics( std::ostream & out );
+
+  protected:
+
+    //! An idle table, building a new one if every table is leased out
+    ISATTable * checkout_table();
+
+    void return_table( ISATTable * table );
+
+    std::string _material;
+
+    unsigned int _n_species;
+
+    libMesh::Real _tolerance, _omega_floor, _radius_T, _radius_rho;
+
+    unsigned int _max_records, _max_search;
+
+    //! Every table built so far; only grows when all of them are leased out
+    std::vector<std::unique_ptr<ISATTable> > _tables;
+
+    //! Tables not currently leased
+    std::vector<ISATTable*> _idle_tables;
+
+    //! Guards the pool only; never held while a table is used
+    std::mutex _tables_mutex;
+
+  private:
+
+    ISATTableStore();
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_ISAT_TABLE_H
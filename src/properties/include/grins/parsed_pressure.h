@@ -60,6 +60,8 @@ namespace GRINS
       libmesh_error_msg("Error: Must supply input pressure using key "+var+"!\n");
 
     this->set_parameter(this->_func, input, var, "DIE!" );
+
+    this->analyze_func();
   }
 
 } // end namespace GRINS
@@ -32,7 +32,9 @@
 #include "libmesh/parsed_function.h"
 
 // C++
+#include <cctype>
 #include <string>
+#include <vector>
 
 namespace GRINS
 {
@@ -45,7 +47,12 @@ namespace GRINS
   {
   public:
 
-    ParsedPropertyBase() : _func("") {};
+    ParsedPropertyBase()
+      : _func(""),
+      _is_constant(false),
+      _constant_value(0.0),
+      _depends_on_space(true)
+    {};
     virtual ~ParsedPropertyBase() = default;
 
     virtual void init(libMesh::FEMSystem* /*system*/){};
@@ -61,13 +68,32 @@ namespace GRINS
       for cases where the function must not be zero. */
     bool check_func_nonzero( const std::string & function ) const;
 
+    //! Classify the parsed expression so evaluation can skip the interpreter
+    /*! Subclasses must call this once _func has been parsed. Expressions
+      that depend on neither space nor time, and have no inline variables
+      that could later be changed as parameters, are folded to a scalar. */
+    void analyze_func();
+
     // User specified parsed function
     libMesh::ParsedFunction<libMesh::Number> _func;
 
+    //! The expression was folded to _constant_value
+    bool _is_constant;
+
+    libMesh::Real _constant_value;
+
+    //! The expression references x, y or z
+    bool _depends_on_space;
+
+    //! Returns true if name appears as an identifier in expression
+    static bool has_identifier( const std::string & expression, const std::string & name );
+
   private:
 
     libMesh::Real op_context_impl(AssemblyContext & context, unsigned int qp) const;
 
+    void op_context_elem_impl(AssemblyContext & context, std::vector<libMesh::Real> & values) const;
+
     libMesh::Real op_point_impl(const libMesh::Point & p, const libMesh::Real time);
 
   };
@@ -77,6 +103,9 @@ namespace GRINS
   inline
   libMesh::Real ParsedPropertyBase<DerivedType>::op_context_impl(AssemblyContext& context, unsigned int qp) const
   {
+    if( _is_constant )
+      return _constant_value;
+
     // FIXME: We should be getting the variable index to get the qps from the context
     // not hardcode it to be 0
     const std::vector<libMesh::Point>& x = context.get_element_fe(0)->get_xyz();
@@ -91,6 +120,39 @@ namespace GRINS
     return value;
   }
 
+  template<typename DerivedType>
+  inline
+  void ParsedPropertyBase<DerivedType>::op_context_elem_impl(AssemblyContext& context,
+                                                             std::vector<libMesh::Real> & values) const
+  {
+    const unsigned int n_qpoints = context.get_element_qrule().n_points();
+
+    if( _is_constant )
+      {
+        values.assign(n_qpoints, _constant_value);
+        return;
+      }
+
+    libMesh::ParsedFunction<libMesh::Number> & mutable_func =
+      const_cast<libMesh::ParsedFunction<libMesh::Number> &>(_func);
+
+    // One interpreter call covers the whole element
+    if( !_depends_on_space )
+      {
+        values.assign(n_qpoints, mutable_func(libMesh::Point(0.0),context.time));
+        return;
+      }
+
+    // FIXME: We should be getting the variable index to get the qps from the context
+    // not hardcode it to be 0
+    const std::vector<libMesh::Point>& x = context.get_element_fe(0)->get_xyz();
+
+    values.resize(n_qpoints);
+
+    for( unsigned int qp = 0; qp != n_qpoints; qp++ )
+      values[qp] = mutable_func(x[qp],context.time);
+  }
+
   template<typename DerivedType>
   inline
   libMesh::Real ParsedPropertyBase<DerivedType>::op_point_impl( const libMesh::Point& p, const libMesh::Real time )
@@ -109,6 +171,62 @@ namespace GRINS
 
     return is_nonzero;
   }
+
+  template<typename DerivedType>
+  inline
+  void ParsedPropertyBase<DerivedType>::analyze_func()
+  {
+    const std::string & expression = _func.expression();
+
+    _depends_on_space = has_identifier(expression,"x") ||
+      has_identifier(expression,"y") ||
+      has_identifier(expression,"z");
+
+    bool depends_on_time = has_identifier(expression,"t");
+
+    // Inline variables can be changed later through parameter
+    // registration, so those expressions are never folded
+    bool has_inline_variables = (expression.find(":=") != std::string::npos);
+
+    _is_constant = !_depends_on_space && !depends_on_time && !has_inline_variables;
+
+    if( _is_constant )
+      _constant_value = _func(libMesh::Point(0.0),0.0);
+  }
+
+  template<typename DerivedType>
+  inline
+  bool ParsedPropertyBase<DerivedType>::has_identifier( const std::string & expression,
+                                                        const std::string & name )
+  {
+    std::size_t i = 0;
+    const std::size_t n = expression.size();
+
+    while( i < n )
+      {
+        const char c = expression[i];
+
+        // Skip numeric literals, including exponents like 1e-3
+        if( std::isdigit(c) || c == '.' )
+          {
+            while( i < n && (std::isalnum(expression[i]) || expression[i] == '.') )
+              i++;
+          }
+        else if( std::isalpha(c) || c == '_' )
+          {
+            std::size_t start = i;
+            while( i < n && (std::isalnum(expression[i]) || expression[i] == '_') )
+              i++;
+
+            if( expression.compare(start, i-start, name) == 0 )
+              return true;
+          }
+        else
+          i++;
+      }
+
+    return false;
+  }
 } // end namespace GRINS
 
 #endif // GRINS_PARSED_PROPERTY_BASE_H
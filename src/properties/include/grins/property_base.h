@@ -32,9 +32,11 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/fem_system.h"
 #include "libmesh/point.h"
+#include "libmesh/quadrature.h"
 
 // C++
 #include <string>
+#include <vector>
 
 namespace GRINS
 {
@@ -52,6 +54,10 @@ namespace GRINS
 
     libMesh::Real operator()(AssemblyContext & context, unsigned int qp) const;
 
+    //! Evaluate at every element quadrature point in one call
+    /*! values is resized to the number of quadrature points. */
+    void operator()(AssemblyContext & context, std::vector<libMesh::Real> & values) const;
+
     libMesh::Real operator()(const libMesh::Point & p, const libMesh::Real time);
 
   };
@@ -63,6 +69,13 @@ namespace GRINS
     return static_cast<const DerivedType*>(this)->op_context_impl(context,qp);
   }
 
+  template<typename DerivedType>
+  inline
+  void PropertyBase<DerivedType>::operator()(AssemblyContext & context, std::vector<libMesh::Real> & values) const
+  {
+    static_cast<const DerivedType*>(this)->op_context_elem_impl(context,values);
+  }
+
   template<typename DerivedType>
   inline
   libMesh::Real PropertyBase<DerivedType>::operator()(const libMesh::Point & p, const libMesh::Real time)
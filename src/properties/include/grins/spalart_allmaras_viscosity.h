@@ -61,9 +61,19 @@ namespace GRINS
 
     libMesh::Real operator()(AssemblyContext& context, unsigned int qp) const;
 
+    //! Values at every element quadrature point
+    void operator()(AssemblyContext& context, std::vector<libMesh::Real>& values) const;
+
     libMesh::Real operator()( const libMesh::Point& p, const libMesh::Real time=0 )
     { return _mu(p,time); }
 
+    //! Derivative of the total viscosity with respect to the turbulence variable nu
+    libMesh::Real deriv( AssemblyContext& context, unsigned int qp ) const;
+
+    //! The turbulence variable the eddy viscosity depends on
+    const TurbulenceFEVariables & turbulence_vars() const
+    { return _turbulence_vars; }
+
     // Registers all parameters in this physics and in its property
     // classes
     virtual void register_parameter
@@ -0,0 +1,287 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_TABULATED_SPECIES_THERMO_H
+#define GRINS_TABULATED_SPECIES_THERMO_H
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+namespace GRINS
+{
+  //! Species enthalpies and heat capacities tabulated on a uniform temperature grid
+  /*!
+    The tables are filled once from an exact thermo Evaluator, before threads
+    are forked, and are then only read. Values at each grid temperature are
+    stored contiguously over species, so a mixture evaluation only touches two
+    adjacent rows of each table.
+
+    h_s is interpolated with cubic Hermite polynomials using the tabulated
+    cp_s as slopes, so it matches the exact values and derivatives at the grid
+    points. cp_s is interpolated with a clamped cubic spline. Both are fourth
+    order accurate in the grid spacing where the exact curves are smooth; the
+    breakpoints of piecewise curve fits reduce that locally, which is what
+    midpoint_errors() is for.
+  */
+  class TabulatedSpeciesThermo
+  {
+  public:
+
+    //! Grid covering [T_min,T_max] with spacing no larger than delta_T
+    TabulatedSpeciesThermo( unsigned int n_species,
+                            libMesh::Real T_min,
+                            libMesh::Real T_max,
+                            libMesh::Real delta_T );
+
+    ~TabulatedSpeciesThermo() = default;
+
+    //! Fill the tables from an exact Evaluator
+    /*! The Evaluator must provide h_s(T,species) and cp_s(T,P,Y,cp_s). */
+    template<typename Evaluator>
+    void tabulate( Evaluator & evaluator );
+
+    //! Largest interpolation errors at the interval midpoints
+    /*! Errors are relative to the largest magnitude of each species
+        quantity over the table, so species with h_s crossing zero are
+        measured sensibly. */
+    template<typename Evaluator>
+    void midpoint_errors( Evaluator & evaluator,
+                          libMesh::Real & h_error,
+                          libMesh::Real & cp_error ) const;
+
+    //! True if T lies within the tabulated range
+    bool in_range( libMesh::Real T ) const
+    { return (T >= _T_min) && (T <= _T_max); }
+
+    libMesh::Real h_s( libMesh::Real T, unsigned int species ) const;
+
+    libMesh::Real cp_s( libMesh::Real T, unsigned int species ) const;
+
+    //! h_s for all species at T
+    void h_s( libMesh::Real T, std::vector<libMesh::Real> & h ) const;
+
+    //! cp_s for all species at T
+    void cp_s( libMesh::Real T, std::vector<libMesh::Real> & cp ) const;
+
+    //! Mixture heat capacity, sum_s Y_s cp_s
+    libMesh::Real cp( libMesh::Real T, const std::vector<libMesh::Real> & Y ) const;
+
+    unsigned int n_species() const
+    { return _n_species; }
+
+    unsigned int n_points() const
+    { return _n_points; }
+
+    libMesh::Real T_min() const
+    { return _T_min; }
+
+    libMesh::Real T_max() const
+    { return _T_max; }
+
+    libMesh::Real delta_T() const
+    { return _delta_T; }
+
+  private:
+
+    TabulatedSpeciesThermo();
+
+    //! Interval index and local coordinate in [0,1] of T
+    void locate( libMesh::Real T, unsigned int & i, libMesh::Real & t ) const;
+
+    //! Solve for the cp spline second derivatives given the end slopes of each species
+    void build_cp_spline( const std::vector<libMesh::Real> & dcp_dT_min,
+                          const std::vector<libMesh::Real> & dcp_dT_max );
+
+    libMesh::Real interp_h( unsigned int i, libMesh::Real t, unsigned int species ) const;
+
+    libMesh::Real interp_cp( unsigned int i, libMesh::Real t, unsigned int species ) const;
+
+    const unsigned int _n_species;
+
+    const libMesh::Real _T_min;
+
+    const libMesh::Real _T_max;
+
+    const unsigned int _n_points;
+
+    const libMesh::Real _delta_T;
+
+    //! Tables indexed [i*_n_species + s] for grid point i and species s
+    std::vector<libMesh::Real> _h;
+    std::vector<libMesh::Real> _cp;
+
+    //! Second derivatives of the cp spline at the grid points
+    std::vector<libMesh::Real> _cp_d2;
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  inline
+  void TabulatedSpeciesThermo::locate( libMesh::Real T, unsigned int & i, libMesh::Real & t ) const
+  {
+    libmesh_assert( this->in_range(T) );
+
+    const libMesh::Real x = (T - _T_min)/_delta_T;
+
+    i = std::min( static_cast<unsigned int>(x), _n_points-2 );
+    t = x - i;
+  }
+
+  inline
+  libMesh::Real TabulatedSpeciesThermo::interp_h( unsigned int i, libMesh::Real t, unsigned int species ) const
+  {
+    const unsigned int a = i*_n_species + species;
+    const unsigned int b = a + _n_species;
+
+    const libMesh::Real t2 = t*t;
+    const libMesh::Real t3 = t2*t;
+
+    return (2*t3 - 3*t2 + 1)*_h[a] + (t3 - 2*t2 + t)*_delta_T*_cp[a]
+      + (3*t2 - 2*t3)*_h[b] + (t3 - t2)*_delta_T*_cp[b];
+  }
+
+  inline
+  libMesh::Real TabulatedSpeciesThermo::interp_cp( unsigned int i, libMesh::Real t, unsigned int species ) const
+  {
+    const unsigned int a = i*_n_species + species;
+    const unsigned int b = a + _n_species;
+
+    const libMesh::Real s = 1.0 - t;
+
+    return s*_cp[a] + t*_cp[b]
+      + _delta_T*_delta_T/6.0*( (s*s*s - s)*_cp_d2[a] + (t*t*t - t)*_cp_d2[b] );
+  }
+
+  inline
+  libMesh::Real TabulatedSpeciesThermo::h_s( libMesh::Real T, unsigned int species ) const
+  {
+    unsigned int i;
+    libMesh::Real t;
+    this->locate(T,i,t);
+    return this->interp_h(i,t,species);
+  }
+
+  inline
+  libMesh::Real TabulatedSpeciesThermo::cp_s( libMesh::Real T, unsigned int species ) const
+  {
+    unsigned int i;
+    libMesh::Real t;
+    this->locate(T,i,t);
+    return this->interp_cp(i,t,species);
+  }
+
+  template<typename Evaluator>
+  inline
+  void TabulatedSpeciesThermo::tabulate( Evaluator & evaluator )
+  {
+    // Species heat capacities don't depend on the composition, but the
+    // Evaluator interface wants one
+    std::vector<libMesh::Real> Y(_n_species, 1.0/_n_species);
+    std::vector<libMesh::Real> cp_s(_n_species);
+
+    for( unsigned int i = 0; i < _n_points; i++ )
+      {
+        const libMesh::Real T = _T_min + i*_delta_T;
+
+        evaluator.cp_s( T, 0.0, Y, cp_s );
+
+        for( unsigned int s = 0; s < _n_species; s++ )
+          {
+            _h[i*_n_species+s] = evaluator.h_s( T, s );
+            _cp[i*_n_species+s] = cp_s[s];
+          }
+      }
+
+    // End slopes of cp for the clamped spline, by one-sided second order
+    // differences that stay inside the table
+    const libMesh::Real eps = 1.0e-4*_delta_T;
+
+    std::vector<libMesh::Real> cp_1(_n_species), cp_2(_n_species);
+    std::vector<libMesh::Real> dcp_dT_min(_n_species), dcp_dT_max(_n_species);
+
+    evaluator.cp_s( _T_min+eps, 0.0, Y, cp_1 );
+    evaluator.cp_s( _T_min+2*eps, 0.0, Y, cp_2 );
+    for( unsigned int s = 0; s < _n_species; s++ )
+      dcp_dT_min[s] = (-3*_cp[s] + 4*cp_1[s] - cp_2[s])/(2*eps);
+
+    const unsigned int last = (_n_points-1)*_n_species;
+    evaluator.cp_s( _T_max-eps, 0.0, Y, cp_1 );
+    evaluator.cp_s( _T_max-2*eps, 0.0, Y, cp_2 );
+    for( unsigned int s = 0; s < _n_species; s++ )
+      dcp_dT_max[s] = (3*_cp[last+s] - 4*cp_1[s] + cp_2[s])/(2*eps);
+
+    this->build_cp_spline( dcp_dT_min, dcp_dT_max );
+  }
+
+  template<typename Evaluator>
+  inline
+  void TabulatedSpeciesThermo::midpoint_errors( Evaluator & evaluator,
+                                                libMesh::Real & h_error,
+                                                libMesh::Real & cp_error ) const
+  {
+    std::vector<libMesh::Real> h_scale(_n_species, 0.0), cp_scale(_n_species, 0.0);
+
+    for( unsigned int i = 0; i < _n_points; i++ )
+      for( unsigned int s = 0; s < _n_species; s++ )
+        {
+          h_scale[s] = std::max( h_scale[s], std::abs(_h[i*_n_species+s]) );
+          cp_scale[s] = std::max( cp_scale[s], std::abs(_cp[i*_n_species+s]) );
+        }
+
+    std::vector<libMesh::Real> Y(_n_species, 1.0/_n_species);
+    std::vector<libMesh::Real> cp_s(_n_species);
+
+    h_error = 0.0;
+    cp_error = 0.0;
+
+    for( unsigned int i = 0; i < _n_points-1; i++ )
+      {
+        const libMesh::Real T = _T_min + (i+0.5)*_delta_T;
+
+        evaluator.cp_s( T, 0.0, Y, cp_s );
+
+        for( unsigned int s = 0; s < _n_species; s++ )
+          {
+            const libMesh::Real dh = std::abs( this->interp_h(i,0.5,s) - evaluator.h_s(T,s) );
+            const libMesh::Real dcp = std::abs( this->interp_cp(i,0.5,s) - cp_s[s] );
+
+            if( h_scale[s] > 0.0 )
+              h_error = std::max( h_error, dh/h_scale[s] );
+
+            if( cp_scale[s] > 0.0 )
+              cp_error = std::max( cp_error, dcp/cp_scale[s] );
+          }
+      }
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_TABULATED_SPECIES_THERMO_H
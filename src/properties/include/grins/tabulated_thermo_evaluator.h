@@ -0,0 +1,213 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_TABULATED_THERMO_EVALUATOR_H
+#define GRINS_TABULATED_THERMO_EVALUATOR_H
+
+// C++
+#include <memory>
+#include <sstream>
+#include <string>
+#include <valarray>
+#include <vector>
+
+// GRINS
+#include "grins/tabulated_species_thermo.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/getpot.h"
+
+namespace GRINS
+{
+  //! Evaluator that replaces the species thermo of another Evaluator with table lookups
+  /*!
+    Everything but cp, cp_s, cv, and h_s is inherited from Evaluator. Those
+    are interpolated from the TabulatedSpeciesThermo owned by the mixture,
+    which build_table() fills once from an exact Evaluator before threads
+    are forked. Temperatures outside of the table fall back to Evaluator.
+    Evaluator is expected to derive from AntiochEvaluator.
+
+    The table is controlled by the options in
+    Materials/<material>/GasMixture/ThermoTable: enabled, T_min, T_max,
+    delta_T, and tolerance. The tolerance bounds the interpolation error
+    at the interval midpoints, relative to the largest magnitude of each
+    species quantity over the table; we error out if it's not met.
+
+    Like Evaluator, this class is expected to be constructed *after* threads
+    have been forked and will only live during the lifetime of the thread.
+  */
+  template<typename Evaluator>
+  class TabulatedThermoEvaluator : public Evaluator
+  {
+  public:
+
+    template<typename Mixture>
+    TabulatedThermoEvaluator( const Mixture & mixture )
+      : Evaluator(mixture),
+        _table(mixture.thermo_table())
+    {
+      if( !_table )
+        libmesh_error_msg("ERROR: The thermo table must be built before constructing a TabulatedThermoEvaluator!");
+    }
+
+    virtual ~TabulatedThermoEvaluator() = default;
+
+    //! Returns true if the user asked for tabulated thermo for this material
+    static bool enabled( const GetPot & input, const std::string & material )
+    { return input( "Materials/"+material+"/GasMixture/ThermoTable/enabled", false ); }
+
+    //! Build the table from an exact Evaluator and hand it to the mixture
+    template<typename Mixture>
+    static void build_table( const GetPot & input, const std::string & material, Mixture & mixture );
+
+    libMesh::Real cp( const libMesh::Real & T, const libMesh::Real P, const std::vector<libMesh::Real> & Y )
+    {
+      if( _table->in_range(T) )
+        return _table->cp(T,Y);
+
+      return Evaluator::cp(T,P,Y);
+    }
+
+    void cp_s( const libMesh::Real & T,
+               const libMesh::Real P,
+               const std::vector<libMesh::Real> & Y,
+               std::vector<libMesh::Real> & cp_s )
+    {
+      if( _table->in_range(T) )
+        _table->cp_s(T,cp_s);
+      else
+        Evaluator::cp_s(T,P,Y,cp_s);
+    }
+
+    libMesh::Real cv( const libMesh::Real & T, const libMesh::Real P, const std::vector<libMesh::Real> & Y )
+    {
+      if( _table->in_range(T) )
+        return _table->cp(T,Y) - this->R_mix(Y);
+
+      return Evaluator::cv(T,P,Y);
+    }
+
+    libMesh::Real h_s( const libMesh::Real & T, unsigned int species )
+    {
+      if( _table->in_range(T) )
+        return _table->h_s(T,species);
+
+      return Evaluator::h_s(T,species);
+    }
+
+    //! Batched mixture heat capacity, species-major Y[s][p]
+    void cp( const std::valarray<libMesh::Real> & T,
+             const std::valarray<libMesh::Real> & P,
+             const std::vector<std::valarray<libMesh::Real> > & Y,
+             std::valarray<libMesh::Real> & cp_mix );
+
+    //! Batched species enthalpies, species-major h[s][p]
+    void h_s( const std::valarray<libMesh::Real> & T,
+              std::vector<std::valarray<libMesh::Real> > & h );
+
+  protected:
+
+    const TabulatedSpeciesThermo * _table;
+
+  private:
+
+    TabulatedThermoEvaluator();
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+  template<typename Evaluator>
+  template<typename Mixture>
+  inline
+  void TabulatedThermoEvaluator<Evaluator>::build_table( const GetPot & input,
+                                                         const std::string & material,
+                                                         Mixture & mixture )
+  {
+    const std::string prefix = "Materials/"+material+"/GasMixture/ThermoTable/";
+
+    const libMesh::Real T_min = input( prefix+"T_min", 200.0 );
+    const libMesh::Real T_max = input( prefix+"T_max", 6000.0 );
+    const libMesh::Real delta_T = input( prefix+"delta_T", 10.0 );
+    const libMesh::Real tolerance = input( prefix+"tolerance", 1.0e-4 );
+
+    std::unique_ptr<TabulatedSpeciesThermo>
+      table( new TabulatedSpeciesThermo( mixture.n_species(), T_min, T_max, delta_T ) );
+
+    Evaluator exact(mixture);
+    table->tabulate(exact);
+
+    libMesh::Real h_error, cp_error;
+    table->midpoint_errors( exact, h_error, cp_error );
+
+    if( h_error > tolerance || cp_error > tolerance )
+      {
+        std::stringstream error;
+        error << "ERROR: Thermo table for material " << material
+              << " does not meet the requested tolerance " << tolerance << "!\n"
+              << "       Relative midpoint errors: h_s " << h_error
+              << ", cp_s " << cp_error << "\n"
+              << "       Decrease " << prefix << "delta_T or increase "
+              << prefix << "tolerance.\n";
+        libmesh_error_msg(error.str());
+      }
+
+    mixture.set_thermo_table(table);
+  }
+
+  template<typename Evaluator>
+  inline
+  void TabulatedThermoEvaluator<Evaluator>::cp( const std::valarray<libMesh::Real> & T,
+                                                const std::valarray<libMesh::Real> & P,
+                                                const std::vector<std::valarray<libMesh::Real> > & Y,
+                                                std::valarray<libMesh::Real> & cp_mix )
+  {
+    libmesh_assert_equal_to( Y.size(), _table->n_species() );
+    libmesh_assert_equal_to( T.size(), cp_mix.size() );
+
+    for( std::size_t p = 0; p < T.size(); p++ )
+      {
+        this->gather_point( Y, p );
+        cp_mix[p] = this->cp( T[p], P[p], this->_Y_point );
+      }
+  }
+
+  template<typename Evaluator>
+  inline
+  void TabulatedThermoEvaluator<Evaluator>::h_s( const std::valarray<libMesh::Real> & T,
+                                                 std::vector<std::valarray<libMesh::Real> > & h )
+  {
+    const unsigned int n_species = _table->n_species();
+
+    libmesh_assert_equal_to( h.size(), n_species );
+
+    for( std::size_t p = 0; p < T.size(); p++ )
+      for( unsigned int s = 0; s < n_species; s++ )
+        h[s][p] = this->h_s( T[p], s );
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_TABULATED_THERMO_EVALUATOR_H
@@ -73,11 +73,12 @@ namespace GRINS
       @param desired_nu Wavenumber at which to calculate the absorption, [\f$ cm^{-1} \f$]
       @param species The string representing the species of interest (much match species given in input file)
       @param termo_pressure The thermodynamic pressure (in [Pa]), or -1.0 if non-constant
+      @param voigt_cutoff Lines whose contribution to \f$ k_{\nu} \f$ at desired_nu is bounded by this value [\f$ cm^{-1} \f$] are skipped, 0.0 (default) includes every line
     */
     AbsorptionCoeff(std::shared_ptr<Chemistry> & chem, std::shared_ptr<HITRAN> & hitran,
                     libMesh::Real nu_min, libMesh::Real nu_max,
                     libMesh::Real desired_nu, const std::string & species,
-                    libMesh::Real thermo_pressure);
+                    libMesh::Real thermo_pressure, libMesh::Real voigt_cutoff = 0.0);
 
     //! Calculate the absorption coefficient at a quadratue point
     virtual libMesh::Real operator()(const libMesh::FEMContext & context,
@@ -97,6 +98,23 @@ namespace GRINS
                               const unsigned int qoi_index,
                               const libMesh::Real time);
 
+    //! Calculate the absorption coefficient at a QP with known reference coordinates
+    /*!
+      The state is interpolated directly from the element solution, skipping the inverse map.
+    */
+    virtual libMesh::Real value_at_reference_point( const libMesh::FEMContext & context,
+                                                    const libMesh::Point & qp_xyz,
+                                                    const libMesh::Point & qp_ref,
+                                                    const libMesh::Real time );
+
+    //! Calculate the derivatives at a QP with known reference coordinates
+    virtual void derivatives_at_reference_point( libMesh::FEMContext & context,
+                                                 const libMesh::Point & qp_xyz,
+                                                 const libMesh::Point & qp_ref,
+                                                 const libMesh::Real & JxW,
+                                                 const unsigned int qoi_index,
+                                                 const libMesh::Real time );
+
     //! Clones the current object
     virtual std::unique_ptr<libMesh::FEMFunctionBase<libMesh::Real> > clone() const;
 
@@ -138,17 +156,67 @@ namespace GRINS
     //! 2D coefficient matrix for approximating the Voigt profile
     std::vector<std::vector<libMesh::Real> > _voigt_coeffs;
 
+    //! Absorption coefficient [cm^-1] below which a line in its Voigt wing is skipped, 0.0 if disabled
+    libMesh::Real _voigt_cutoff;
+
+    //! Evaluate the temperature [K], total pressure [Pa] and mass fractions at the given point
+    void point_state(const libMesh::FEMContext & context, const libMesh::Point & qp_xyz,
+                     libMesh::Real & T, libMesh::Real & P, std::vector<libMesh::Real> & Y) const;
+
+    //! Same as point_state(), but interpolates from the element solution at reference coordinates qp_ref
+    void reference_point_state(const libMesh::FEMContext & context, const libMesh::Point & qp_ref,
+                               libMesh::Real & T, libMesh::Real & P, std::vector<libMesh::Real> & Y) const;
+
+    //! Interpolate variable var of the element solution at reference coordinates qp_ref
+    libMesh::Real reference_point_value(const libMesh::FEMContext & context, unsigned int var,
+                                        const libMesh::Point & qp_ref) const;
+
+    //! Thermodynamic pressure [Pa]
+    libMesh::Real thermo_pressure() const;
+
+    //! Absorption coefficient [cm^-1] summed over all lines in [_min_index,_max_index]
+    /*!
+      The point state (pressure, mole fraction, partition function ratios, Doppler
+      coefficient) is computed once and the lines are then swept directly
+      over the contiguous HITRAN arrays. Equivalent to summing kv() over the window,
+      up to roundoff and lines dropped by the Voigt cutoff.
+    */
+    libMesh::Real kv_window(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y);
+
+    //! Derivatives of kv_window() with respect to T, P and the mass fractions
+    /*!
+      Skips the same lines as kv_window(), so the two stay consistent when
+      the Voigt cutoff is enabled.
+    */
+    void kv_window_derivs(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y,
+                          libMesh::Real & dkv_dT, libMesh::Real & dkv_dP, std::vector<libMesh::Real> & dkv_dY);
+
+    //! True if the Voigt cutoff is enabled and drops a line with the given parameters
+    /*!
+      @param a Voigt parameter \f$ a \f$ of the line
+      @param w Voigt parameter \f$ w \f$ of the line at desired_nu
+      @param nu_D Doppler width of the line [cm^-1]
+      @param kv_per_phi Absorption coefficient per unit profile value, \f$ S P X \f$ [cm^-2]
+
+      Once \f$ |w| > 6 \f$ the Gaussian core is below roundoff and the line's
+      contribution is bounded by its Lorentzian wing, which is compared with the cutoff.
+    */
+    bool below_voigt_cutoff(libMesh::Real a, libMesh::Real w, libMesh::Real nu_D, libMesh::Real kv_per_phi) const;
+
+    //! below_voigt_cutoff() for line i, using the per-line helpers
+    bool below_voigt_cutoff(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
+
     //! Absorption coefficient [cm^-1]
-    libMesh::Real kv(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real kv(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Absorption coefficient temperature derivative
-    libMesh::Real d_kv_dT(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_kv_dT(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Absorption coefficient pressure derivative
-    libMesh::Real d_kv_dP(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_kv_dP(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Absorption coefficient  derivative with respect to mass fraction of species species_index
-    libMesh::Real d_kv_dY(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int species_index, unsigned int i);
+    libMesh::Real d_kv_dY(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int species_index, unsigned int i);
 
     //! Linestrength [cm^-2 atm^-1]
     libMesh::Real Sw(libMesh::Real T, libMesh::Real P, unsigned int i);
@@ -169,16 +237,16 @@ namespace GRINS
     libMesh::Real d_nuD_dP(libMesh::Real T, unsigned int i);
 
     //! Collisional broadening [cm^-1]
-    libMesh::Real nu_C(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real nu_C(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Collisional broadening temperature derivative
-    libMesh::Real d_nuC_dT(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_nuC_dT(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Collisional broadening pressure derivative
-    libMesh::Real d_nuC_dP(libMesh::Real T, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_nuC_dP(libMesh::Real T, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Collisional broadening derivative with respect to mass fraction of species species_index
-    libMesh::Real d_nuC_dY(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int species_index, unsigned int i);
+    libMesh::Real d_nuC_dY(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int species_index, unsigned int i);
 
     //! Calculate the Voigt profile [cm^-1]
     /*!
@@ -188,31 +256,31 @@ namespace GRINS
       McLean A, Mitchell C, Swanston D\n
       Journal of Electron Spectroscopy and Related Phenomena 1994 vol: 69 (2) pp: 125-132
     */
-    libMesh::Real voigt(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real voigt(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Voigt profile temperature derivative
-    libMesh::Real d_voigt_dT(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_voigt_dT(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Voigt profile pressure derivative
-    libMesh::Real d_voigt_dP(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_voigt_dP(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Voigt profile  derivative with respect to mass fraction of species species_index
-    libMesh::Real d_voigt_dY(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int species_index, unsigned int i);
+    libMesh::Real d_voigt_dY(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int species_index, unsigned int i);
 
     //! Initialize the coeff matrix for calculating the Voigt profile
     void init_voigt();
 
     //! Voigt a parameter
-    libMesh::Real voigt_a(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real voigt_a(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Voigt a parameter temperature derivative
-    libMesh::Real d_voigt_a_dT(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_voigt_a_dT(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Voigt a parameter pressure derivative
-    libMesh::Real d_voigt_a_dP(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int i);
+    libMesh::Real d_voigt_a_dP(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int i);
 
     //! Voigt a parameter  derivative with respect to mass fraction of species species_index
-    libMesh::Real d_voigt_a_dY(libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> Y, unsigned int species_index, unsigned int i);
+    libMesh::Real d_voigt_a_dY(libMesh::Real T, libMesh::Real P, const std::vector<libMesh::Real> & Y, unsigned int species_index, unsigned int i);
 
     //! Voigt w parameter
     libMesh::Real voigt_w(libMesh::Real T, libMesh::Real P, unsigned int i);
@@ -230,7 +298,7 @@ namespace GRINS
     libMesh::Real d_nu_dP(unsigned int i);
 
     //! Derivative of the mole fraction of the species of interest with respect to species_index
-    libMesh::Real dX_dY(std::vector<libMesh::Real> Y, unsigned int species_index);
+    libMesh::Real dX_dY(const std::vector<libMesh::Real> & Y, unsigned int species_index);
 
     //! Partition Function derivative (finite difference)
     libMesh::Real dQ_dT(libMesh::Real T, unsigned int iso);
@@ -28,6 +28,7 @@
 // C++
 #include <vector>
 #include <ostream>
+#include <unordered_map>
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -146,6 +147,24 @@ namespace GRINS
 
     std::vector<QoIBase*> _qois;
 
+    //! Indices of the QoIs that are assembled on every element
+    std::vector<unsigned int> _unrestricted_elem_qois;
+
+    //! Indices of the QoIs restricted to each element, keyed by element id
+    /*! Built from QoIBase::active_elem_ids() so QoIs that only touch a
+      few elements (e.g. along a rayfire) are not called everywhere. */
+    std::unordered_map<libMesh::dof_id_type,std::vector<unsigned int> > _restricted_elem_qois;
+
+    //! Until init() has been called, every QoI is called on every element
+    bool _elem_qoi_tables_built;
+
+    //! (Re)build _unrestricted_elem_qois and _restricted_elem_qois
+    void build_elem_qoi_tables();
+
+    //! Calls (qoi.*func)(context,q) on each QoI that contributes on the current element
+    void element_qoi_dispatch( AssemblyContext & context,
+                               void (QoIBase::*func)(AssemblyContext &, const unsigned int) );
+
   };
 
   inline
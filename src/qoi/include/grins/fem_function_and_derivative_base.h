@@ -46,6 +46,30 @@ namespace GRINS
                               const unsigned int qoi_index,
                               const libMesh::Real time = 0.) = 0;
 
+    //! Function evaluation at a point whose reference coordinates in context.get_elem() are known
+    /*!
+      Callers that evaluate repeatedly at the same points, e.g. IntegratedFunction,
+      can cache qp_ref and save subclasses the inverse map.
+      The default just calls operator().
+    */
+    virtual Output value_at_reference_point( const libMesh::FEMContext & context,
+                                             const libMesh::Point & qp_xyz,
+                                             const libMesh::Point & /*qp_ref*/,
+                                             const libMesh::Real time = 0. )
+    { return (*this)(context,qp_xyz,time); }
+
+    //! Function derivative evaluation at a point whose reference coordinates in context.get_elem() are known
+    /*!
+      The default just calls derivatives().
+    */
+    virtual void derivatives_at_reference_point( libMesh::FEMContext & context,
+                                                 const libMesh::Point & qp_xyz,
+                                                 const libMesh::Point & /*qp_ref*/,
+                                                 const libMesh::Real & JxW,
+                                                 const unsigned int qoi_index,
+                                                 const libMesh::Real time = 0. )
+    { this->derivatives(context,qp_xyz,JxW,qoi_index,time); }
+
   };
 
 }
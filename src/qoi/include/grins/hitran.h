@@ -27,6 +27,7 @@
 
 
 // C++
+#include <cstddef>
 #include <vector>
 #include <string>
 
@@ -53,6 +54,13 @@ namespace GRINS
     Note the partition function data <b>must</b> explicitly include a value at the given reference temperature,
     which is currently 296K for HITRAN.
 
+    Alternatively, both data sets can be read from a single binary file written by write_binary()
+    (see the hitran_to_binary program). The binary file is memory mapped, read only, so MPI ranks
+    on the same node share its pages and no parsing is done at startup.
+
+    In either case, the spectroscopic lines are sorted by increasing linecenter wavenumber
+    so that wavenumber windows can be found by binary search.
+
     The basic units for values are those given by HITRAN, which currently are [cm] and [atm]
   */
   class HITRAN
@@ -69,6 +77,17 @@ namespace GRINS
     HITRAN(const std::string & data_file, const std::string & partition_function_file,
            libMesh::Real T_min, libMesh::Real T_max, libMesh::Real T_step);
 
+    //! Constructor from a binary file written by write_binary()
+    /*!
+      The temperature range of the partition function values is stored in the file.
+    */
+    HITRAN(const std::string & binary_file);
+
+    ~HITRAN();
+
+    //! Write the spectroscopic and partition function data to a binary file
+    void write_binary(const std::string & binary_file) const;
+
     //! Isotopologue ID
     unsigned int isotopologue(unsigned int index);
 
@@ -100,9 +119,31 @@ namespace GRINS
     //! Return the data size
     unsigned int get_data_size();
 
+    //! Index of the first line with linecenter wavenumber strictly greater than nu
+    /*! Returns get_data_size() if there is no such line */
+    unsigned int upper_bound_index(libMesh::Real nu) const;
+
+    //! Index of the first line with linecenter wavenumber greater than or equal to nu
+    /*! Returns get_data_size() if there is no such line */
+    unsigned int lower_bound_index(libMesh::Real nu) const;
+
     //! Finite difference derivative for partition function
     libMesh::Real partition_function_derivative(libMesh::Real T, unsigned int iso);
 
+    //! Number of isotopologues with partition function data
+    unsigned int n_isotopologues() const;
+
+    //! Contiguous arrays of the line data, indexed like the accessors above
+    /*! These are intended for kernels that sweep over a window of lines. */
+    const unsigned int * isotopologue_data() const;
+    const libMesh::Real * nu0_data() const;
+    const libMesh::Real * sw_data() const;
+    const libMesh::Real * gamma_air_data() const;
+    const libMesh::Real * gamma_self_data() const;
+    const libMesh::Real * elower_data() const;
+    const libMesh::Real * n_air_data() const;
+    const libMesh::Real * delta_air_data() const;
+
   protected:
     libMesh::Real _Tmin, _Tmax, _Tstep;
 
@@ -119,7 +160,7 @@ namespace GRINS
     //! Cached since it is used frequently
     std::vector<libMesh::Real> _qT0;
 
-    // Vectors of data values
+    // Vectors of data values, only filled when parsing text files
     std::vector<unsigned int> _isotop;
     std::vector<libMesh::Real> _nu;
     std::vector<libMesh::Real> _sw;
@@ -129,8 +170,37 @@ namespace GRINS
     std::vector<libMesh::Real> _n;
     std::vector<libMesh::Real> _delta_air;
 
-    //! Vector for partition function values for all isotopologues
-    std::vector<std::vector<libMesh::Real>> _qT;
+    //! Partition function values for all isotopologues, only filled when parsing text files
+    /*! Stored isotopologue-major, _q_size values per isotopologue */
+    std::vector<libMesh::Real> _qT;
+
+    //! Number of isotopologues with partition function data
+    unsigned int _n_iso;
+
+    // Views of the data values, pointing either into the vectors above
+    // or into the memory mapped binary file
+    const unsigned int * _isotop_data;
+    const libMesh::Real * _nu_data;
+    const libMesh::Real * _sw_data;
+    const libMesh::Real * _gamma_air_data;
+    const libMesh::Real * _gamma_self_data;
+    const libMesh::Real * _elower_data;
+    const libMesh::Real * _n_data;
+    const libMesh::Real * _delta_air_data;
+    const libMesh::Real * _qT_data;
+
+    //! Memory mapped binary file, if any
+    void * _mapped_data;
+    std::size_t _mapped_size;
+
+    //! Sort the parsed lines by linecenter wavenumber, if they are not already
+    void sort_by_nu0();
+
+    //! Point the data views at the member vectors
+    void set_data_views();
+
+    //! Cache the partition function values at the reference temperature
+    void cache_qT0();
 
     //! Find the index into _T corresponding to the given temperature
     int T_index(libMesh::Real T);
@@ -139,10 +209,14 @@ namespace GRINS
     libMesh::Real get_partition_function_value(libMesh::Real T, unsigned int iso);
 
     //! Linear interpolation helper function
-    libMesh::Real interpolate_values( int index_r, libMesh::Real T_star, const std::vector<libMesh::Real> & y) const;
+    libMesh::Real interpolate_values( int index_r, libMesh::Real T_star, const libMesh::Real * y) const;
 
     //! User should not call empty constructor
     HITRAN();
+
+    //! Not copyable, since we may own a memory mapping
+    HITRAN(const HITRAN &) = delete;
+    HITRAN & operator=(const HITRAN &) = delete;
   };
 
 }
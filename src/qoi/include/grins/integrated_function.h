@@ -69,6 +69,9 @@ namespace GRINS
 
     virtual bool assemble_on_sides() const override;
 
+    //! Only the elements along the rayfire contribute
+    virtual bool active_elem_ids( std::vector<libMesh::dof_id_type> & elem_ids ) const override;
+
     //! Compute the qoi value.
     virtual void element_qoi( AssemblyContext & context,
                               const unsigned int qoi_index ) override;
@@ -110,12 +113,39 @@ namespace GRINS
     //! Pointer to RayfireMesh object
     std::shared_ptr<RayfireMesh> _rayfire;
 
+    //! Quadrature data along the rayfire within a single main mesh element
+    struct RayfireQuadrature
+    {
+      //! Physical coordinates of the QPs on the rayfire elem
+      std::vector<libMesh::Point> xyz;
+
+      //! Reference coordinates of the QPs in the main mesh elem
+      std::vector<libMesh::Point> ref;
+
+      //! JxW of the QPs on the rayfire elem
+      std::vector<libMesh::Real> JxW;
+    };
+
+    //! Rayfire quadrature keyed by main mesh elem id
+    /*!
+      Rebuilt by init() and reinit(). Shared between clones, like the
+      RayfireMesh itself, since it is only read during assembly.
+    */
+    std::shared_ptr<std::map<libMesh::dof_id_type,RayfireQuadrature> > _rayfire_qps;
+
+    //! Precompute the rayfire quadrature on every main mesh elem along the rayfire
+    void cache_rayfire_quadrature(const libMesh::MeshBase & mesh);
+
+    //! The cached rayfire quadrature for the given main mesh elem, or NULL if it is not on the rayfire
+    const RayfireQuadrature * rayfire_quadrature(const libMesh::dof_id_type elem_id) const;
+
     //! Compute the value of a QoI at a QP
-    libMesh::Real qoi_value(Function & f, AssemblyContext & context, const libMesh::Point & xyz);
+    libMesh::Real qoi_value(Function & f, AssemblyContext & context, const libMesh::Point & xyz,
+                            const libMesh::Point & qp_ref);
 
     //! Compute derivatiuves at QP
     void qoi_derivative(Function & f, AssemblyContext & context, const libMesh::Point & qp_xyz,
-                        const libMesh::Real JxW, const unsigned int qoi_index);
+                        const libMesh::Point & qp_ref, const libMesh::Real JxW, const unsigned int qoi_index);
 
   protected:
     //! Cache a non-const pointer to the MultiphysicsSystem object
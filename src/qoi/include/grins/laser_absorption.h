@@ -31,6 +31,7 @@
 #include "grins/fem_function_and_derivative_base.h"
 #include "grins/spectroscopic_transmission.h"
 #include "grins/laser_intensity_profile_base.h"
+#include "grins/rayfire_packet.h"
 
 namespace GRINS
 {
@@ -98,6 +99,14 @@ namespace GRINS
     //! Just call the default copy constructor
     virtual QoIBase * clone() const override;
 
+    //! Trace all the beam rays together, then init the internal QoIs
+    virtual void init( const GetPot & input,
+                       const MultiphysicsSystem & system,
+                       unsigned int qoi_num) override;
+
+    //! reinit the internal QoIs and refresh the beam element list
+    virtual void reinit(MultiphysicsSystem & system) override;
+
     virtual void element_qoi( AssemblyContext& context,
                               const unsigned int qoi_index) override;
 
@@ -119,6 +128,10 @@ namespace GRINS
     //! gauss quadrature weights cached here for use in parallel_op()
     std::vector<libMesh::Real> _quadrature_weights;
 
+    //! The rays of every quadrature point, shared with the internal QoIs
+    /*! Shared between clones, since it is only read during assembly */
+    std::shared_ptr<RayfirePacket> _packet;
+
   };
 
 }
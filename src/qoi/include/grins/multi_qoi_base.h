@@ -78,6 +78,9 @@ namespace GRINS
     //! reinit all internal QoI objects
     virtual void reinit(MultiphysicsSystem & system) override;
 
+    //! Union of the internal QoI element sets, if all of them are restricted
+    virtual bool active_elem_ids( std::vector<libMesh::dof_id_type> & elem_ids ) const override;
+
   protected:
     //! A vector of internal QoIs that are *NOT* known to the context or CompositeQoI
     std::vector<std::unique_ptr<QoIBase>> _qois;
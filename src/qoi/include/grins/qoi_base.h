@@ -28,6 +28,7 @@
 
 // C++
 #include <iomanip>
+#include <vector>
 
 // libMesh
 #include "libmesh/diff_qoi.h"
@@ -81,6 +82,16 @@ namespace GRINS
     //! Reinitialize QoI
     virtual void reinit(MultiphysicsSystem & /*system*/) {}
 
+    //! Optionally restrict the element interior assembly to a set of elements
+    /*!
+     * Returns false (the default) if the QoI may contribute on any element.
+     * Otherwise, fills elem_ids with the ids of the local elements on which
+     * element_qoi() and element_qoi_derivative() contribute and returns true.
+     * CompositeQoI queries this after init() and reinit().
+     */
+    virtual bool active_elem_ids( std::vector<libMesh::dof_id_type>& /*elem_ids*/ ) const
+    { return false; }
+
     //! Compute the qoi value for element interiors.
     /*! Override this method if your QoI is defined on element interiors */
     virtual void element_qoi( AssemblyContext& /*context*/,
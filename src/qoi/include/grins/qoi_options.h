@@ -42,6 +42,18 @@ namespace GRINS
 
     static const std::string default_file_prefix()
     { return "default_file_prefix"; }
+
+    static const std::string timesteps_per_output()
+    { return "timesteps_per_output"; }
+
+    static const std::string time_series_file()
+    { return "time_series_file"; }
+
+    static const std::string time_series_format()
+    { return "time_series_format"; }
+
+    static const std::string time_series_buffer_size()
+    { return "time_series_buffer_size"; }
   };
 } // end namespace GRINS
 
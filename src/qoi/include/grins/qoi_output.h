@@ -26,6 +26,10 @@
 #define GRINS_QOI_OUTPUT_H
 
 #include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
 
 // libMesh forward declarations
 class GetPot;
@@ -48,14 +52,26 @@ namespace GRINS
     (which is really just a wrapper around calling output from QoI classes).
     Currently, the user can enable printing the QoI info to the display
     (std::cout) and to a file by specifing the filename in the corresponding
-    input option. */
+    input option.
+
+    For unsteady solves, the QoIs can also be recorded every
+    Output/QoI/timesteps_per_output time steps into a time-series file
+    (Output/QoI/time_series_file, default <default_file_prefix>_time_series.dat).
+    Only rank 0 writes. Rows are buffered and appended every
+    Output/QoI/time_series_buffer_size rows so memory stays bounded.
+    Output/QoI/time_series_format is either 'ascii' (default), with one
+    whitespace separated row of "t_step time qoi_0 ... qoi_n" per output and
+    a '#' header line of names, or 'binary'. The binary file starts with the
+    8 characters "GRINSQTS", a uint32 column count and, per column, a uint32
+    name length and the name, followed by rows of doubles. */
   class QoIOutput
   {
   public:
 
     QoIOutput( const GetPot & input );
 
-    ~QoIOutput(){}
+    //! Flushes any buffered time-series rows
+    ~QoIOutput();
 
     //! Function to query whether any input options set to output qoi
     /*! Returns true if user requested to output QoI in any one of the avaiable
@@ -68,6 +84,24 @@ namespace GRINS
       the System. */
     void output_qois( const CompositeQoI & qois, const libMesh::Parallel::Communicator & comm ) const;
 
+    //! Whether QoIs should be recorded as a time series during unsteady solves
+    bool output_time_series_set() const
+    { return (_timesteps_per_time_series > 0); }
+
+    unsigned int timesteps_per_time_series() const
+    { return _timesteps_per_time_series; }
+
+    //! Append the current QoI values to the time series
+    /*! This function assumes that the qoi values have been assembled by
+      the System. */
+    void output_time_series( const CompositeQoI & qois,
+                             const libMesh::Parallel::Communicator & comm,
+                             unsigned int t_step,
+                             libMesh::Real time );
+
+    //! Write any buffered time-series rows to the file
+    void flush_time_series();
+
   protected:
 
     bool _output_to_display;
@@ -76,6 +110,27 @@ namespace GRINS
 
     std::string _file_prefix;
 
+    //! Output QoI time series every this many time steps; 0 disables
+    unsigned int _timesteps_per_time_series;
+
+    std::string _time_series_filename;
+
+    bool _time_series_binary;
+
+    //! Number of rows to buffer before appending to the file
+    unsigned int _time_series_buffer_size;
+
+    //! Whether the file has been created and its header written
+    bool _time_series_started;
+
+    //! Number of values in each row: t_step, time and each QoI
+    unsigned int _n_time_series_columns;
+
+    //! Buffered rows, stored contiguously (only on rank 0)
+    std::vector<libMesh::Real> _time_series_buffer;
+
+    void write_time_series_header( const std::vector<std::string> & names );
+
   };
 
 } // end namespace GRINS
@@ -29,6 +29,7 @@
 // libMesh
 #include "libmesh/quadrature.h"
 #include "libmesh/mesh.h"
+#include "libmesh/point_locator_base.h"
 
 // GRINS
 #include "grins/qoi_base.h"
@@ -62,6 +63,12 @@ namespace GRINS
     of the main mesh.
 
     Refinement and coarsening of the rayfire mesh are supported through the reinit() function.
+
+    On a distributed main mesh, each processor only marches the ray through the
+    elements it owns and hands the march off to the owner of the next element
+    when the ray leaves its partition. Each processor then holds its own segment(s)
+    of the 1D mesh, and map_to_rayfire_elem() and elem_ids_in_rayfire() only
+    know about local elements.
   */
   class RayfireMesh
   {
@@ -107,6 +114,16 @@ namespace GRINS
     */
     void init(const libMesh::MeshBase & mesh_base);
 
+    //! Initialization using an existing point locator on mesh_base
+    /*!
+      Allows several rayfires on the same mesh to share a single locator,
+      e.g. from build_point_locator().
+    */
+    void init(const libMesh::MeshBase & mesh_base, const libMesh::PointLocatorBase & locator);
+
+    //! Build a point locator on mesh_base suitable for finding rayfire origins
+    static std::unique_ptr<libMesh::PointLocatorBase> build_point_locator(const libMesh::MeshBase & mesh_base);
+
     /*!
       This function takes in an elem_id on the main mesh and returns an elem from the 1D rayfire mesh.
       @param elem_id The ID of the elem on the main mesh
@@ -145,12 +162,20 @@ namespace GRINS
     //! Spherical polar angle (in radians)
     libMesh::Real _phi;
 
+    //! Processor-local communicator for the 1D mesh on a distributed main mesh
+    /*! Must be declared before _mesh so that it outlives it. */
+    std::unique_ptr<libMesh::Parallel::Communicator> _local_comm;
+
     //! Internal 1D mesh of EDGE2 elements
     std::unique_ptr<libMesh::Mesh> _mesh;
 
     //! Map of main mesh elem_id to rayfire mesh elem_id
+    /*! Only contains local elements if the main mesh is distributed */
     std::map<libMesh::dof_id_type,libMesh::dof_id_type> _elem_id_map;
 
+    //! Whether init() has already been called
+    bool _initialized;
+
     //! Filename to output rayfire after init()
     //! Defaults to empty string (no output)
     std::string _output_filename;
@@ -160,6 +185,22 @@ namespace GRINS
 
     void validate_rayfire_angles();
 
+    //! Perform the rayfire on the current main mesh and build the 1D mesh
+    void build_rayfire(const libMesh::MeshBase & mesh_base, const libMesh::PointLocatorBase & locator);
+
+    //! Rayfire on a distributed mesh, passing the march between processors
+    void build_rayfire_distributed(const libMesh::MeshBase & mesh_base, const libMesh::PointLocatorBase & locator);
+
+    //! Walk the rayfire from start_elem, adding 1D elems, until it leaves the mesh
+    /*!
+      If stop_at_partition is true, also stop when the next elem is not owned
+      by this processor.
+      @param[in,out] start_point Entry point into start_elem; on return, the entry point into the returned elem
+      @return The next elem along the rayfire, or NULL if the rayfire left the mesh
+    */
+    const libMesh::Elem * march(const libMesh::MeshBase & mesh_base, const libMesh::Elem * start_elem,
+                                libMesh::Point & start_point, bool stop_at_partition);
+
     //! Private function to get a rayfire elem from main_mesh elem ID
     /*!
       Does not return a const pointer, and is used within this class to simplify
@@ -192,7 +233,7 @@ namespace GRINS
       @return NULL Origin is not on the mesh
       @return Elem* First elem on the rayfire
     */
-    const libMesh::Elem * get_start_elem(const libMesh::MeshBase& mesh_base);
+    const libMesh::Elem * get_start_elem(const libMesh::PointLocatorBase & locator);
 
     //! Ensures the rayfire doesn't wander into the middle of an elem
     bool validate_edge(const libMesh::Point & start_point, const libMesh::Point & end_point, const libMesh::Elem * side_elem, const libMesh::Elem * neighbor);
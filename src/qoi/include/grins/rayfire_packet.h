@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_RAYFIRE_PACKET_H
+#define GRINS_RAYFIRE_PACKET_H
+
+// C++
+#include <memory>
+#include <vector>
+
+// GRINS
+#include "grins/rayfire_mesh.h"
+
+namespace GRINS
+{
+  //! A bundle of parallel RayfireMesh objects traced on the same mesh
+  /*!
+    Used by LaserAbsorption, which fires one ray per beam quadrature point.
+    All rays are initialized with a single shared point locator instead of
+    each building their own, and the packet keeps the union of the main mesh
+    elements crossed by any ray so that elements away from the beam can be
+    skipped with a single lookup.
+
+    The RayfireMesh objects are shared (not copied) with the QoIs that
+    integrate along them, so initializing them here makes their own
+    RayfireMesh::init() calls no-ops.
+  */
+  class RayfirePacket
+  {
+  public:
+
+    RayfirePacket() = default;
+
+    //! Add a ray to the packet; must be done before init()
+    void add_ray(const std::shared_ptr<RayfireMesh> & ray);
+
+    unsigned int n_rays() const
+    { return _rays.size(); }
+
+    //! Trace all rays on mesh_base using one point locator
+    void init(const libMesh::MeshBase & mesh_base);
+
+    //! Refresh the element list once the rays have been reinit() after AMR
+    /*! The rays themselves are reinit by the QoIs that own them, so the
+      refinement and coarsening work is only done once per ray. */
+    void update_elem_ids();
+
+    //! Whether any ray in the packet crosses the main mesh elem elem_id
+    bool has_elem(const libMesh::dof_id_type elem_id) const;
+
+  private:
+
+    std::vector<std::shared_ptr<RayfireMesh> > _rays;
+
+    //! Sorted union of the main mesh elem IDs crossed by the rays
+    std::vector<libMesh::dof_id_type> _elem_ids;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_RAYFIRE_PACKET_H
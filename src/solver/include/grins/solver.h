@@ -88,6 +88,9 @@ namespace GRINS
 
     void print_qoi( SolverContext& context );
 
+    //! Assemble the QoIs and append them to the QoI time series, if requested for this time step
+    void output_qoi_time_series( SolverContext& context, unsigned int t_step, libMesh::Real time );
+
   protected:
 
     NonlinearSolverOptions _nonlinear_solver_options;
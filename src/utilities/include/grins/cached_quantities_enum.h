@@ -67,6 +67,8 @@ namespace GRINS
                            OMEGA_DOT,
                            VELOCITY_PENALTY,
                            VELOCITY_PENALTY_BASE,
+                           //! Number of cached quantities; must remain last
+                           N_CACHED_QUANTITIES
     };
   } // namespace Cache
 } // namespace GRINS
@@ -29,7 +29,6 @@
 //C++
 #include <set>
 #include <vector>
-#include <map>
 
 // libMesh
 #include "libmesh/libmesh.h"
@@ -40,31 +39,71 @@
 
 namespace GRINS
 {
+  //! Per-element cache of quantities evaluated at quadrature points
+  /*!
+    Storage is a dense array indexed by Cache::CachedQuantities. The
+    underlying vectors are never deallocated by clear(), so once the first
+    element has been processed, repopulating the cache does no heap
+    allocation as long as the number of quadrature points (and species)
+    does not grow. Callers may either fill the storage in place using the
+    get_*_to_fill() methods, or build their own vectors and swap them in
+    with the swap_*() methods. The set_*() methods copy into the existing
+    storage and are kept for convenience.
+  */
   class CachedValues
   {
   public:
 
-    CachedValues() = default;
+    CachedValues();
     ~CachedValues() = default;
 
     void add_quantity( unsigned int quantity );
 
     void add_quantities( const std::set<unsigned int>& cache_list );
 
+    //! Mark all quantities as unset. Storage capacity is retained.
     void clear();
 
-    bool is_active(unsigned int quantity);
+    bool is_active(unsigned int quantity) const;
 
-    void set_values( unsigned int quantity, std::vector<libMesh::Number>& values );
+    void set_values( unsigned int quantity, const std::vector<libMesh::Number>& values );
 
     void set_gradient_values( unsigned int quantity,
-                              std::vector<libMesh::Gradient>& values );
+                              const std::vector<libMesh::Gradient>& values );
 
     void set_vector_values( unsigned int quantity,
-                            std::vector<std::vector<libMesh::Number> >& values );
+                            const std::vector<std::vector<libMesh::Number> >& values );
 
     void set_vector_gradient_values( unsigned int quantity,
-                                     std::vector<std::vector<libMesh::Gradient> >& values );
+                                     const std::vector<std::vector<libMesh::Gradient> >& values );
+
+    //! Swap values into the cache. On return, values holds the previous cache storage.
+    void swap_values( unsigned int quantity, std::vector<libMesh::Number>& values );
+
+    void swap_gradient_values( unsigned int quantity,
+                               std::vector<libMesh::Gradient>& values );
+
+    void swap_vector_values( unsigned int quantity,
+                             std::vector<std::vector<libMesh::Number> >& values );
+
+    void swap_vector_gradient_values( unsigned int quantity,
+                                      std::vector<std::vector<libMesh::Gradient> >& values );
+
+    //! Resize storage for quantity to n_qpoints, mark it set, and return it for filling in place
+    std::vector<libMesh::Number>& get_values_to_fill( unsigned int quantity,
+                                                      unsigned int n_qpoints );
+
+    std::vector<libMesh::Gradient>& get_gradient_values_to_fill( unsigned int quantity,
+                                                                 unsigned int n_qpoints );
+
+    //! Resize storage for quantity to n_qpoints x n_components, mark it set, and return it for filling in place
+    std::vector<std::vector<libMesh::Number> >& get_vector_values_to_fill( unsigned int quantity,
+                                                                          unsigned int n_qpoints,
+                                                                          unsigned int n_components );
+
+    std::vector<std::vector<libMesh::Gradient> >& get_vector_gradient_values_to_fill( unsigned int quantity,
+                                                                                     unsigned int n_qpoints,
+                                                                                     unsigned int n_components );
 
     const std::vector<libMesh::Number>& get_cached_values( unsigned int quantity ) const;
 
@@ -80,10 +119,20 @@ namespace GRINS
 
     std::set<unsigned int> _cache_list;
 
-    std::map<unsigned int,std::vector<libMesh::Number> > _cached_values;
-    std::map<unsigned int,std::vector<libMesh::Gradient> > _cached_gradient_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Number> >  > _cached_vector_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Gradient> >  > _cached_vector_gradient_values;
+    //! Dense lookup of _cache_list
+    std::vector<bool> _active;
+
+    std::vector<std::vector<libMesh::Number> > _cached_values;
+    std::vector<std::vector<libMesh::Gradient> > _cached_gradient_values;
+    std::vector<std::vector<std::vector<libMesh::Number> > > _cached_vector_values;
+    std::vector<std::vector<std::vector<libMesh::Gradient> > > _cached_vector_gradient_values;
+
+    //! Track which quantities have been set since the last clear()
+    /*! These are only used for sanity checking in debug modes. */
+    std::vector<bool> _values_set;
+    std::vector<bool> _gradient_values_set;
+    std::vector<bool> _vector_values_set;
+    std::vector<bool> _vector_gradient_values_set;
 
   };
 
@@ -93,6 +142,45 @@ namespace GRINS
     return _cache_list.size();
   }
 
+  inline
+  bool CachedValues::is_active(unsigned int quantity) const
+  {
+    libmesh_assert_less( quantity, _active.size() );
+    return _active[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Number>& CachedValues::get_cached_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_values.size() );
+    libmesh_assert( _values_set[quantity] );
+    return _cached_values[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Gradient>& CachedValues::get_cached_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_gradient_values.size() );
+    libmesh_assert( _gradient_values_set[quantity] );
+    return _cached_gradient_values[quantity];
+  }
+
+  inline
+  const std::vector<std::vector<libMesh::Number> >& CachedValues::get_cached_vector_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_vector_values.size() );
+    libmesh_assert( _vector_values_set[quantity] );
+    return _cached_vector_values[quantity];
+  }
+
+  inline
+  const std::vector<std::vector<libMesh::Gradient> >& CachedValues::get_cached_vector_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, _cached_vector_gradient_values.size() );
+    libmesh_assert( _vector_gradient_values_set[quantity] );
+    return _cached_vector_gradient_values[quantity];
+  }
+
 } // namespace GRINS
 
 #endif // GRINS_CACHED_VALUES_H
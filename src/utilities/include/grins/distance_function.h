@@ -38,6 +38,7 @@
 #include "libmesh/fe_base.h"
 #include "libmesh/system.h"
 #include "libmesh/unstructured_mesh.h"
+#include "libmesh/quadrature.h"
 
 // Forward Declarations
 namespace libMesh {
@@ -63,7 +64,7 @@ namespace GRINS {
     /**
      * Destructor
      */
-    ~DistanceFunction () = default;
+    ~DistanceFunction ();
 
     /**
      * Initializes the distance
@@ -71,9 +72,18 @@ namespace GRINS {
     virtual void initialize () override;
 
     /**
-     * Compute distance from input node to boundary_mesh
+     * Compute distance from input node to boundary_mesh. Uses the spatial
+     * index over the boundary nodes while it is available (i.e. during
+     * compute()), otherwise falls back to node_to_boundary_brute_force().
      */
-    libMesh::Real node_to_boundary (const libMesh::Node* node);
+    libMesh::Real node_to_boundary (const libMesh::Node* node) const;
+
+    /**
+     * Compute distance from input node to boundary_mesh by checking
+     * every boundary node. Gives results identical to node_to_boundary(),
+     * kept for verification and timing of the indexed search.
+     */
+    libMesh::Real node_to_boundary_brute_force (const libMesh::Node* node) const;
 
     /**
      * Initialize "distance_function" equation system by computing
@@ -86,10 +96,56 @@ namespace GRINS {
      */
     std::unique_ptr< libMesh::DenseVector<libMesh::Real> > interpolate (const libMesh::Elem* elem, const std::vector<libMesh::Point>& qts) const;
 
+    /**
+     * Interpolate the distance function to the quadrature points of every
+     * active local element, using a rule of the same type and order as qrule,
+     * and keep the result for qp_distances(). The distance field is fixed
+     * between mesh changes, so this only needs redoing after the mesh changes
+     * (see clear_qp_distances()).
+     */
+    void cache_qp_distances (const libMesh::QBase& qrule);
+
+    /**
+     * Drop the cached quadrature point distances, e.g. after AMR.
+     */
+    void clear_qp_distances ();
+
+    /**
+     * Whether cache_qp_distances() has been called since the last clear.
+     */
+    bool has_qp_distances () const
+    { return !_qp_distance_offsets.empty(); }
+
+    /**
+     * Distances at the quadrature points of elem, as cached by
+     * cache_qp_distances(). elem must be active and local.
+     */
+    const libMesh::Real* qp_distances (const libMesh::Elem& elem) const;
+
 
 
   private:
 
+    /**
+     * k-d tree over the nodes of the boundary mesh elements.
+     * Defined in distance_function.C.
+     */
+    class BoundaryNodeTree;
+
+    /**
+     * Distance from node to the boundary, checking only elem_containing_min
+     * (the boundary element owning the nearest boundary node) and its point
+     * neighbors.
+     */
+    libMesh::Real distance_near_elem (const libMesh::Node* node,
+                                      const libMesh::Elem* elem_containing_min) const;
+
+    /**
+     * Spatial index over the boundary mesh. Only built while compute()
+     * holds the boundary mesh serialized, since it stores element pointers.
+     */
+    std::unique_ptr<BoundaryNodeTree> _boundary_tree;
+
     /**
      * Pointer to EquationSystems object
      */
@@ -110,6 +166,24 @@ namespace GRINS {
      */
     std::unique_ptr<libMesh::FEBase> _dist_fe;
 
+    /**
+     * Interpolate distance function to points qpts (in reference space)
+     * for element *elem, writing the n_qpts values to distance
+     */
+    void interpolate (const libMesh::Elem* elem, const std::vector<libMesh::Point>& qpts,
+                      libMesh::Real* distance) const;
+
+    /**
+     * Start of each element's entries in _qp_distances, indexed by element id.
+     * Elements without cached values hold std::numeric_limits<std::size_t>::max().
+     */
+    std::vector<std::size_t> _qp_distance_offsets;
+
+    /**
+     * Distances at element quadrature points, stored contiguously per element
+     */
+    std::vector<libMesh::Real> _qp_distances;
+
   };
 
   /**
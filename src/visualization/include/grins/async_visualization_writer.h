@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2019 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ASYNC_VISUALIZATION_WRITER_H
+#define GRINS_ASYNC_VISUALIZATION_WRITER_H
+
+// C++
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_base.h"
+
+namespace GRINS
+{
+  //! Writes visualization snapshots from a background thread
+  /*! The caller does all the collective work (gathering the nodal
+      solution, copying the mesh) and hands the writer a self-contained
+      Snapshot, so the writer thread never touches the live
+      EquationSystems and never communicates with other processors.
+      At most max_pending snapshots are held at once; push() blocks
+      until a slot frees up, which bounds the memory held in flight.
+      With max_pending = 2, one snapshot is written while the next
+      is being filled.
+
+      The libMesh I/O classes log to the global PerfLog, which is not
+      thread safe, so libMesh::perflog must stay disabled while
+      snapshots are outstanding. push() and finish() must be called
+      from the same thread. */
+  class AsyncVisualizationWriter
+  {
+  public:
+
+    //! Everything needed to write one visualization dump
+    struct Snapshot
+    {
+      //! Serial copy of the mesh, living on a single processor communicator
+      /*! Node and element ids must match the original. The writer thread
+          calls prepare_for_use() on it, so the caller doesn't have to. */
+      std::unique_ptr<libMesh::MeshBase> mesh;
+
+      //! Nodal solution of all systems, ordered as by EquationSystems::build_solution_vector
+      std::vector<libMesh::Number> soln;
+
+      std::vector<std::string> names;
+
+      std::vector<std::string> formats;
+
+      std::string filename_prefix;
+
+      libMesh::Real time;
+    };
+
+    AsyncVisualizationWriter( unsigned int max_pending );
+
+    //! Blocks until all pending snapshots are written
+    ~AsyncVisualizationWriter();
+
+    //! Queue a snapshot for writing, blocking while the queue is full
+    void push( std::unique_ptr<Snapshot> snapshot );
+
+    //! Block until all queued snapshots are written and stop the writer thread
+    /*! Rethrows the first exception raised while writing, if any. */
+    void finish();
+
+    //! Formats that can be written from a Snapshot
+    static bool supports_format( const std::string & format );
+
+  private:
+
+    void run();
+
+    static void write( Snapshot & snapshot );
+
+    unsigned int _max_pending;
+
+    std::deque<std::unique_ptr<Snapshot> > _queue;
+
+    //! Number of snapshots popped but not yet written
+    unsigned int _n_writing;
+
+    bool _done;
+
+    std::exception_ptr _error;
+
+    std::mutex _mutex;
+
+    std::condition_variable _cond;
+
+    std::thread _thread;
+  };
+
+} // end namespace GRINS
+#endif // GRINS_ASYNC_VISUALIZATION_WRITER_H
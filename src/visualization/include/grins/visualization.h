@@ -34,6 +34,9 @@
 #include "libmesh/equation_systems.h"
 
 // GRINS
+#include "grins/async_visualization_writer.h"
+
+// C++
 #include <memory>
 
 // libMesh forward declarations
@@ -57,6 +60,10 @@ namespace GRINS
 
     virtual ~Visualization() = default;
 
+    //! Block until all asynchronously written output is on disk
+    /*! No-op unless vis-options/async_output is enabled. */
+    void wait_for_output();
+
     void output( std::shared_ptr<libMesh::EquationSystems> equation_system );
     void output( std::shared_ptr<libMesh::EquationSystems> equation_system,
                  const unsigned int time_step, const libMesh::Real time );
@@ -103,9 +110,22 @@ namespace GRINS
 
   protected:
 
+    //! Copy the current solution and mesh and queue them for the async writer
+    /*! Collective; only processor 0 keeps the snapshot. */
+    void push_async_snapshot( const libMesh::EquationSystems & equation_system,
+                              const std::string& filename_prefix,
+                              const libMesh::Real time,
+                              const std::vector<std::string> & formats );
+
     // Visualization options
     std::string _vis_output_file_prefix;
     std::vector<std::string> _output_format;
+
+    //! Single processor communicator for the serial mesh snapshots
+    std::unique_ptr<libMesh::Parallel::Communicator> _snapshot_comm;
+
+    //! Non-NULL if vis-options/async_output is enabled
+    std::unique_ptr<AsyncVisualizationWriter> _async_writer;
   };
 }// namespace GRINS
 #endif // GRINS_VISUALIZATION_H
@@ -41,7 +41,7 @@ namespace GRINSTesting
     AbsorptionCoeffTesting( std::shared_ptr<Chemistry> & chem, std::shared_ptr<GRINS::HITRAN> & hitran,
                             libMesh::Real nu_min, libMesh::Real nu_max,
                             libMesh::Real desired_nu, const std::string & species,
-                            libMesh::Real thermo_pressure);
+                            libMesh::Real thermo_pressure, libMesh::Real voigt_cutoff = 0.0);
 
     friend class SpectroscopicTestBase;
   };
@@ -51,8 +51,8 @@ namespace GRINSTesting
                                                             std::shared_ptr<GRINS::HITRAN> & hitran,
                                                             libMesh::Real nu_min, libMesh::Real nu_max,
                                                             libMesh::Real desired_nu, const std::string & species,
-                                                            libMesh::Real thermo_pressure)
-    : GRINS::AbsorptionCoeff<Chemistry>(chem,hitran,nu_min,nu_max,desired_nu,species,thermo_pressure)
+                                                            libMesh::Real thermo_pressure, libMesh::Real voigt_cutoff)
+    : GRINS::AbsorptionCoeff<Chemistry>(chem,hitran,nu_min,nu_max,desired_nu,species,thermo_pressure,voigt_cutoff)
   {}
 }
 
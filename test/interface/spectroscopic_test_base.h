@@ -118,6 +118,54 @@ namespace GRINSTesting
           this->P_param_derivatives(absorb,T,P,Y,i);
           this->Y_param_derivatives(absorb,T,P,Y,i);
         }
+
+      // the fused line kernel should agree with summing the individual lines
+      libMesh::Real kv_sum = 0.0;
+      for (unsigned int i=absorb->_min_index; i<=absorb->_max_index; ++i)
+        kv_sum += absorb->kv(T,P,Y,i);
+
+      CPPUNIT_ASSERT_DOUBLES_EQUAL( kv_sum, absorb->kv_window(T,P,Y), std::abs(kv_sum)*libMesh::TOLERANCE*libMesh::TOLERANCE );
+
+      // A cutoff above the total absorption drops every line in its wing, and
+      // the derivatives must drop the same lines as the value
+      std::shared_ptr<AbsorptionCoeffTesting<GRINS::AntiochChemistry> >
+        absorb_cut( new AbsorptionCoeffTesting<GRINS::AntiochChemistry>(chem,hitran,nu_min,nu_max,nu_desired,species,thermo_pressure,2.0*kv_sum) );
+
+      CPPUNIT_ASSERT( absorb_cut->kv_window(T,P,Y) < kv_sum );
+
+      this->kv_window_derivs_test(absorb_cut,T,P,Y);
+    }
+
+    void kv_window_derivs_test(std::shared_ptr<AbsorptionCoeffTesting<GRINS::AntiochChemistry> > absorb,
+                               libMesh::Real T, libMesh::Real P, std::vector<libMesh::Real> & Y)
+    {
+      libMesh::Real dkv_dT, dkv_dP;
+      std::vector<libMesh::Real> dkv_dY(Y.size());
+      absorb->kv_window_derivs(T,P,Y,dkv_dT,dkv_dP,dkv_dY);
+
+      const libMesh::Real kv = absorb->kv_window(T,P,Y);
+
+      libMesh::Real delta = 1.0e-4;
+      libMesh::Real fd = (absorb->kv_window(T+delta,P,Y) - absorb->kv_window(T-delta,P,Y))/(2.0*delta);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL( fd, dkv_dT, std::abs(kv)*libMesh::TOLERANCE );
+
+      delta = 1.0e-2;
+      fd = (absorb->kv_window(T,P+delta,Y) - absorb->kv_window(T,P-delta,Y))/(2.0*delta);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL( fd, dkv_dP, std::abs(kv)*libMesh::TOLERANCE );
+
+      delta = 1.0e-8;
+      for (unsigned int s=0; s<Y.size(); ++s)
+        {
+          const libMesh::Real Ys = Y[s];
+
+          Y[s] = Ys+delta;
+          const libMesh::Real kv_p = absorb->kv_window(T,P,Y);
+          Y[s] = Ys-delta;
+          const libMesh::Real kv_m = absorb->kv_window(T,P,Y);
+          Y[s] = Ys;
+
+          CPPUNIT_ASSERT_DOUBLES_EQUAL( (kv_p-kv_m)/(2.0*delta), dkv_dY[s], std::abs(kv)*libMesh::TOLERANCE );
+        }
     }
 
     void elem_qoi_derivative_test(std::stringstream & input_stream)
@@ -0,0 +1,33 @@
+#!/bin/bash
+
+set -e
+
+# Writes a few timesteps synchronously and then asynchronously
+# and checks that the files are identical.
+
+INPUT="${GRINS_TEST_INPUT_DIR}/convection_diffusion_unsteady_2d.in"
+
+PREFIX="async_visualization_output"
+
+for ASYNC in false true
+do
+    ${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT \
+                     SolverOptions/TimeStepping/n_timesteps='4' \
+                     screen-options/print_log_info='false' \
+                     vis-options/output_format='tecplot' \
+                     vis-options/timesteps_per_vis='1' \
+                     vis-options/async_output=$ASYNC \
+                     vis-options/vis_output_file_prefix="${PREFIX}_${ASYNC}" \
+                     > ${PREFIX}_${ASYNC}.log
+done
+
+# Otherwise we'd just be comparing two synchronous runs
+grep -q "Writing visualization output asynchronously" ${PREFIX}_true.log
+
+for STEP in "" .0 .1 .2 .3
+do
+    cmp ${PREFIX}_false${STEP}.dat ${PREFIX}_true${STEP}.dat
+done
+
+# Now remove the test turds
+rm ${PREFIX}_false*.dat ${PREFIX}_true*.dat ${PREFIX}_*.log
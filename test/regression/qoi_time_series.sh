@@ -0,0 +1,59 @@
+#!/bin/bash
+
+set -e
+
+# Writes the QoI time series of a short unsteady run in every
+# supported configuration and checks the files against each other.
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/qoi_time_series.in"
+
+PREFIX="qoi_time_series"
+
+# First argument is the time series file, the rest are extra overrides
+run_grins()
+{
+    FILE=$1
+    shift
+    ${LIBMESH_RUN:-} $PROG $INPUT Output/QoI/time_series_file=$FILE "$@"
+}
+
+# Every timestep, flushed after each row
+run_grins ${PREFIX}_every.dat Output/QoI/time_series_buffer_size='1'
+
+# Every timestep, with a buffer that is flushed once mid run and once at the end
+run_grins ${PREFIX}_buffered.dat Output/QoI/time_series_buffer_size='3'
+
+# Every other timestep
+run_grins ${PREFIX}_every_other.dat Output/QoI/timesteps_per_output='2'
+
+# Every timestep, in binary
+run_grins ${PREFIX}_binary.dat Output/QoI/time_series_format='binary'
+
+# Header plus one row for each of the 4 timesteps
+head -n 1 ${PREFIX}_every.dat | grep -q "^# t_step time parsed_interior$"
+
+awk 'NR > 1 { n++; if( $1 != n-1 || NF != 3 ) exit 1 } END { if( n != 4 ) exit 1 }' ${PREFIX}_every.dat
+
+# Buffering must not change the output
+cmp ${PREFIX}_every.dat ${PREFIX}_buffered.dat
+
+# Rows for t_step 1 and 3 only, identical to the full series
+diff <(awk 'NR == 1 || $1 == 1 || $1 == 3' ${PREFIX}_every.dat) ${PREFIX}_every_other.dat
+
+# 8 byte magic, column count, then each name with its length,
+# followed by 4 rows of 3 doubles
+[ "$(head -c 8 ${PREFIX}_binary.dat)" = "GRINSQTS" ]
+
+HEADER_BYTES=$(( 8 + 4 + (4+6) + (4+4) + (4+15) ))
+
+[ $(wc -c < ${PREFIX}_binary.dat) -eq $(( HEADER_BYTES + 4*3*8 )) ]
+
+# The binary values must match the ascii ones to the printed precision
+diff <(od -A n -t f8 -v -w24 -j $HEADER_BYTES ${PREFIX}_binary.dat | \
+           awk '{ printf "%d %.16e %.16e\n", $1, $2, $3 }') \
+     <(awk 'NR > 1 { printf "%d %.16e %.16e\n", $1, $2, $3 }' ${PREFIX}_every.dat)
+
+# Now remove the test turds
+rm ${PREFIX}_every.dat ${PREFIX}_buffered.dat ${PREFIX}_every_other.dat ${PREFIX}_binary.dat
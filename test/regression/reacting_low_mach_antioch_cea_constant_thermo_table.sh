@@ -0,0 +1,30 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/generic_solution_regression"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/reacting_low_mach_antioch_cea_constant_regression.in"
+DATA="${GRINS_TEST_DATA_DIR}/reacting_low_mach_antioch_cea_constant_regression.xdr"
+
+# A MOAB preconditioner
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 10 -sub_pc_type lu -sub_pc_factor_shift_type nonzero"
+
+# Same solve as reacting_low_mach_antioch_cea_constant.sh, but with the
+# species thermo interpolated from a table. The solution must still match
+# the direct gold file, at a looser tolerance than the direct solve.
+TABLE="Materials/2SpeciesNGas/GasMixture/ThermoTable"
+TABLE_OPTIONS="$TABLE/enabled=true $TABLE/delta_T=1.0"
+
+if [ $GRINS_ANTIOCH_ENABLED == 1 ]; then
+   set -e
+
+   ${LIBMESH_RUN:-} $PROG --input $INPUT soln-data=$DATA vars='u v T p w_N2 w_N' norms='L2 H1' tol='1.0e-6' $TABLE_OPTIONS $PETSC_OPTIONS
+
+   # An unattainable table tolerance must be rejected, which shows the
+   # options above really did switch the table on
+   if ${LIBMESH_RUN:-} $PROG --input $INPUT soln-data=$DATA vars='u v T p w_N2 w_N' norms='L2 H1' tol='1.0e-6' $TABLE_OPTIONS $TABLE/tolerance=1.0e-30 $PETSC_OPTIONS > /dev/null 2>&1; then
+      echo "ERROR: Thermo table tolerance was not enforced"
+      exit 1
+   fi
+else
+   exit 77;
+fi
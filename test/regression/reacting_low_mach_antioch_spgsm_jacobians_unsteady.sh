@@ -0,0 +1,13 @@
+#!/bin/bash
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/reacting_low_mach_antioch_spgsm_jacobians_unsteady.in"
+
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 10 -sub_pc_type lu -sub_pc_factor_shift_type nonzero"
+
+if [ $GRINS_ANTIOCH_ENABLED == 1 ]; then
+   ${LIBMESH_RUN:-} $PROG $INPUT $PETSC_OPTIONS
+else
+   exit 77;
+fi
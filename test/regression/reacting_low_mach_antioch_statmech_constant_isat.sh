@@ -0,0 +1,31 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/generic_solution_regression"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/reacting_low_mach_antioch_statmech_constant_regression.in"
+DATA="${GRINS_TEST_DATA_DIR}/reacting_low_mach_antioch_statmech_constant_regression.xdr"
+
+LOG="reacting_low_mach_antioch_statmech_constant_isat.log"
+
+# A MOAB preconditioner
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 10 -sub_pc_type ilu -sub_pc_factor_shift_type nonzero -sub_pc_factor_levels 10"
+
+# Same solve as reacting_low_mach_antioch_statmech_constant.sh, but with
+# the source terms served from ISAT tables. The table error tolerance is
+# tight enough that the solution must still match the direct gold file,
+# at a looser tolerance than the direct solve.
+ISAT_OPTIONS="Materials/2SpeciesNGas/GasMixture/ISAT/enabled=true Materials/2SpeciesNGas/GasMixture/ISAT/tolerance=1.0e-8"
+
+if [ $GRINS_ANTIOCH_ENABLED == 1 ]; then
+   set -e
+   set -o pipefail
+
+   ${LIBMESH_RUN:-} $PROG --input $INPUT soln-data=$DATA vars='u v T p w_N2 w_N' norms='L2 H1' tol='1.0e-6' $ISAT_OPTIONS $PETSC_OPTIONS | tee $LOG
+
+   # The tables must actually have been queried
+   grep -q "ISAT statistics for material 2SpeciesNGas" $LOG
+
+   rm $LOG
+else
+   exit 77;
+fi
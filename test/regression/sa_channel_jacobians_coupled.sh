@@ -0,0 +1,9 @@
+#!/bin/bash
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/sa_channel_jacobians_coupled.in"
+
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 2 -sub_pc_factor_levels 4"
+
+${LIBMESH_RUN:-} $PROG $INPUT $PETSC_OPTIONS
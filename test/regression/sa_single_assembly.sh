@@ -0,0 +1,18 @@
+#!/bin/bash
+
+# Takes a single Newton step of a Spalart-Allmaras system, so the wall
+# distance cache is built from a context that has never seen an element,
+# and checks the analytic Jacobian of that first assembly against finite
+# differences. grins errors out on any element Jacobian mismatch.
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/sa_channel_jacobians_coupled.in"
+
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 2 -sub_pc_factor_levels 4"
+
+${LIBMESH_RUN:-} $PROG $INPUT \
+                 linear-nonlinear-solver/max_nonlinear_iterations='1' \
+                 linear-nonlinear-solver/continue_after_max_iterations='true' \
+                 linear-nonlinear-solver/verify_analytic_jacobians='1.e-6' \
+                 $PETSC_OPTIONS
@@ -0,0 +1,64 @@
+#!/bin/sh
+
+# This script times residual plus Jacobian assembly, without solving, for
+# 2D and 3D incompressible and low Mach Navier-Stokes inputs. It is meant to
+# be run from the test directory of the build tree, i.e. where `make check`
+# is run, so that the relative paths in the input files resolve.
+#
+# The meshes in the inputs are refined to GRINS_BENCHMARK_N_ELEMS_2D per side
+# in 2D (default 40) and GRINS_BENCHMARK_N_ELEMS_3D per side in 3D (default 8)
+# so that assembly dominates setup. The number of timed assemblies defaults
+# to 10 and can be overridden with the first argument to this script or
+# GRINS_BENCHMARK_N_REPEATS in the environment. LIBMESH_RUN is honored.
+#
+# To compare against another revision, run this script from the build tree
+# of each revision; GRINS_ASSEMBLY_BENCHMARK_PROG may point to the program.
+# The output goes to GRINS_BENCHMARK_OUTPUT_FILE if it's set in the environment
+# or to assembly_benchmark.log if it's not. Each line of the summary table is
+# "<input> <dim> <microseconds per element>".
+
+set -e
+
+GRINS_ASSEMBLY_BENCHMARK_PROG=${GRINS_ASSEMBLY_BENCHMARK_PROG:-../src/grins_assembly_benchmark}
+
+GRINS_BENCHMARK_OUTPUT_VALUE=${GRINS_BENCHMARK_OUTPUT_FILE:-assembly_benchmark.log}
+
+GRINS_BENCHMARK_N_REPEATS_VALUE=${GRINS_BENCHMARK_N_REPEATS:-10}
+
+if [ -n "$1" ]; then
+   GRINS_BENCHMARK_N_REPEATS_VALUE=$1
+fi
+
+N2=${GRINS_BENCHMARK_N_ELEMS_2D:-40}
+N3=${GRINS_BENCHMARK_N_ELEMS_3D:-8}
+
+INPUTS_2D="input_files/poiseuille_flow_input.in input_files/low_mach_cavity_benchmark_regression_input.in"
+INPUTS_3D="input_files/thermally_driven_3d_flow.in input_files/3d_low_mach_jacobians_xy.in"
+
+: > ${GRINS_BENCHMARK_OUTPUT_VALUE}
+
+SUMMARY=""
+
+run_case()
+{
+   input=$1
+   dim=$2
+   shift 2
+   echo "Running $input" | tee -a ${GRINS_BENCHMARK_OUTPUT_VALUE}
+   ${LIBMESH_RUN:-} $GRINS_ASSEMBLY_BENCHMARK_PROG $input n_repeats=$GRINS_BENCHMARK_N_REPEATS_VALUE "$@" > assembly_benchmark.tmp 2>&1
+   cat assembly_benchmark.tmp >> ${GRINS_BENCHMARK_OUTPUT_VALUE}
+   usec=$(grep "microseconds per element" assembly_benchmark.tmp | sed 's/.*= //')
+   SUMMARY="$SUMMARY$(basename $input .in) $dim $usec\n"
+}
+
+for input in $INPUTS_2D; do
+   run_case $input 2 Mesh/Generation/n_elems_x=$N2 Mesh/Generation/n_elems_y=$N2
+done
+
+for input in $INPUTS_3D; do
+   run_case $input 3 Mesh/Generation/n_elems_x=$N3 Mesh/Generation/n_elems_y=$N3 Mesh/Generation/n_elems_z=$N3
+done
+
+rm -f assembly_benchmark.tmp
+
+printf "$SUMMARY" | tee -a ${GRINS_BENCHMARK_OUTPUT_VALUE}
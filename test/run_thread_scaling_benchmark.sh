@@ -0,0 +1,65 @@
+#!/bin/sh
+
+# This script times the reacting low Mach regression inputs while varying
+# the number of libMesh threads used for assembly. It is meant to be run
+# from the test directory of the build tree, i.e. where `make check` is run,
+# so that the relative paths to the chemistry files in the input files resolve.
+#
+# The list of thread counts defaults to "1 2 4 8" and can be overridden with
+# the first argument to this script or GRINS_BENCHMARK_N_THREADS in the
+# environment. The argument is preferred if both are specified. LIBMESH_RUN
+# is honored, so e.g. LIBMESH_RUN="mpiexec -np 2" gives a hybrid run.
+#
+# Cases that require Cantera or Antioch are skipped if GRINS was not built
+# with the corresponding library. The output goes to GRINS_BENCHMARK_OUTPUT_FILE
+# if it's set in the environment or to thread_scaling_benchmark.log if it's not.
+# Each line of the summary table is "<input> <n_threads> <wall seconds>".
+
+set -e
+
+GRINS_PROG=${GRINS_PROG:-../src/grins}
+
+GRINS_BENCHMARK_OUTPUT_VALUE=${GRINS_BENCHMARK_OUTPUT_FILE:-thread_scaling_benchmark.log}
+
+GRINS_BENCHMARK_N_THREADS_VALUE=${GRINS_BENCHMARK_N_THREADS:-"1 2 4 8"}
+
+if [ -n "$1" ]; then
+   GRINS_BENCHMARK_N_THREADS_VALUE=$1
+fi
+
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 10 -sub_pc_type ilu -sub_pc_factor_shift_type nonzero -sub_pc_factor_levels 10"
+
+INPUTS=""
+
+if grep -q "define GRINS_HAVE_CANTERA 1" ../grins_config.h 2>/dev/null; then
+   INPUTS="$INPUTS input_files/reacting_low_mach_cantera_regression.in"
+fi
+
+if grep -q "define GRINS_HAVE_ANTIOCH 1" ../grins_config.h 2>/dev/null; then
+   INPUTS="$INPUTS input_files/reacting_low_mach_antioch_statmech_constant_regression.in"
+   INPUTS="$INPUTS input_files/reacting_low_mach_antioch_kinetics_theory_regression.in"
+fi
+
+if [ -z "$INPUTS" ]; then
+   echo "GRINS was built without Cantera or Antioch; nothing to benchmark."
+   exit 0
+fi
+
+: > ${GRINS_BENCHMARK_OUTPUT_VALUE}
+
+SUMMARY=""
+
+for input in $INPUTS; do
+   for n in $GRINS_BENCHMARK_N_THREADS_VALUE; do
+      echo "Running $input with --n_threads=$n" | tee -a ${GRINS_BENCHMARK_OUTPUT_VALUE}
+      start=$(date +%s.%N)
+      ${LIBMESH_RUN:-} $GRINS_PROG $input --n_threads=$n $PETSC_OPTIONS >> ${GRINS_BENCHMARK_OUTPUT_VALUE} 2>&1
+      end=$(date +%s.%N)
+      SUMMARY="$SUMMARY$(basename $input .in) $n $(echo "$end - $start" | bc)\n"
+   done
+done
+
+# Clean up the solution files written by the regression inputs
+rm -f reacting_low_mach_*_regression.xda reacting_low_mach_*_regression.xdr
+
+printf "$SUMMARY" | tee -a ${GRINS_BENCHMARK_OUTPUT_VALUE}